@@ -17,7 +17,14 @@ test_deps_urls = {
     'catch2': "https://github.com/catchorg/Catch2/archive/refs/tags/v3.3.2.zip",
     'corrosion': "https://github.com/corrosion-rs/corrosion/archive/refs/heads/master.zip",
 }
+# Large assets for the fastgltf_benchmarks target, fetched only with --benchmark-corpus as the
+# download is multiple gigabytes. NewSponza and Bistro sit behind interactive download pages and
+# have to be placed into tests/gltf/intel_sponza manually.
+benchmark_corpus_urls = {
+    'glTF-Sample-Models': "https://github.com/KhronosGroup/glTF-Sample-Models/archive/refs/heads/master.zip",
+}
 deps_folder = "deps/"
+corpus_folder = "tests/gltf/"
 
 
 def download_zip_and_extract(url, output_folder, name):
@@ -40,6 +47,15 @@ def download_zip_and_extract(url, output_folder, name):
 
 
 def main():
+    if '--benchmark-corpus' in sys.argv:
+        for name, url in benchmark_corpus_urls.items():
+            try:
+                download_zip_and_extract(url, corpus_folder, name)
+                print(f'Finished downloading {name}')
+            except urllib.error.HTTPError:
+                print(f'Could not download {url}.', file=sys.stderr)
+        return
+
     for name, url in example_deps_urls.items():
         try:
             download_zip_and_extract(url, deps_folder, name)
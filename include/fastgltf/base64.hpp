@@ -72,9 +72,11 @@ namespace fastgltf::base64 {
 #if defined(FASTGLTF_IS_X86)
     void sse4_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     void avx2_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
+    void avx512_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
 
     [[nodiscard]] std::vector<std::uint8_t> sse4_decode(std::string_view encoded);
     [[nodiscard]] std::vector<std::uint8_t> avx2_decode(std::string_view encoded);
+    [[nodiscard]] std::vector<std::uint8_t> avx512_decode(std::string_view encoded);
 #elif defined(FASTGLTF_IS_A64)
     void neon_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     [[nodiscard]] std::vector<std::uint8_t> neon_decode(std::string_view encoded);
@@ -82,6 +84,15 @@ namespace fastgltf::base64 {
     void fallback_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
     void decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding);
 
+    /**
+     * Decodes the base64 string into the output buffer using up to threadCount threads. Every
+     * 4 encoded chars decode into 3 bytes independently of the rest of the input, so the input
+     * is split on 4-char boundaries and each worker runs the fastest available SIMD decoder on
+     * its chunk. Inputs too small for the thread spawns to pay off are decoded on the calling
+     * thread through decode_inplace.
+     */
+    void decode_inplace_parallel(std::string_view encoded, std::uint8_t* output, std::size_t padding, unsigned int threadCount);
+
     [[nodiscard]] std::vector<std::uint8_t> fallback_decode(std::string_view encoded);
     [[nodiscard]] std::vector<std::uint8_t> decode(std::string_view encoded);
 } // namespace fastgltf::base64
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2022 - 2023 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <fastgltf/parser.hpp>
+
+namespace fastgltf {
+    /**
+     * A writer that serializes an Asset back into glTF, symmetric to the Parser's load functions.
+     * The JSON string is emitted directly into a flat buffer without building an intermediate DOM,
+     * and the GLB BIN chunk is gathered straight from the asset's sources::Vector and
+     * sources::ByteView data without staging copies when writing to a file.
+     *
+     * The writer covers the core glTF 2.0 object model. Data that originates from extensions,
+     * such as compressed buffer views or extension material properties, is not serialized and is
+     * expected to have been decoded or stripped beforehand.
+     *
+     * An Exporter instance can be reused across exports to amortise the cost of the internal
+     * JSON buffer allocation. It is not thread-safe.
+     */
+    class Exporter {
+        std::string jsonBuffer;
+
+        Error writeJson(const Asset& asset, bool binaryBuffer);
+
+    public:
+        explicit Exporter() noexcept = default;
+
+        /**
+         * Serializes the given asset into a self-contained binary glTF (GLB) blob. The first
+         * buffer of the asset is written as the BIN chunk when it holds a sources::Vector or
+         * sources::ByteView; any further buffers have to reference external files through
+         * sources::URI.
+         */
+        [[nodiscard]] Expected<std::vector<std::uint8_t>> writeBinaryGLTF(const Asset& asset);
+
+        /**
+         * Serializes the given asset into a GLB file at the given path. Unlike the in-memory
+         * overload this streams the JSON and BIN chunks to disk in sequence, so the buffer
+         * bytes are never copied into an intermediate allocation.
+         */
+        Error writeBinaryGLTF(const Asset& asset, const std::filesystem::path& path);
+
+        /**
+         * Serializes the given asset into a glTF JSON string. Every buffer, including the first,
+         * has to reference an external file through sources::URI.
+         */
+        [[nodiscard]] Expected<std::string> writeGltfJson(const Asset& asset);
+    };
+} // namespace fastgltf
@@ -26,7 +26,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <tuple>
 
 #include "types.hpp"
@@ -86,6 +90,8 @@ namespace fastgltf {
 		MissingExternalBuffer = 9, ///< With Options::LoadExternalBuffers, a external buffer was not found.
 		UnsupportedVersion = 10, ///< The glTF version is not supported by fastgltf.
 		InvalidURI = 11, ///< A URI from a buffer or image failed to be parsed.
+		MissingMeshoptimizer = 12, ///< Options::DecodeMeshoptCompression was used, but fastgltf was compiled without meshoptimizer.
+		MissingDraco = 13, ///< Options::DecodeDracoCompression was used, but fastgltf was compiled without Draco.
     };
 
     // clang-format off
@@ -139,6 +145,9 @@ namespace fastgltf {
 
         // See https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Khronos/KHR_materials_unlit/README.md
         KHR_materials_unlit = 1 << 17,
+
+        // See https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Khronos/KHR_draco_mesh_compression/README.md
+        KHR_draco_mesh_compression = 1 << 18,
     };
     // clang-format on
 
@@ -148,6 +157,45 @@ namespace fastgltf {
     FASTGLTF_ASSIGNMENT_OP_TEMPLATE_MACRO(Extensions, Extensions, &)
     FASTGLTF_UNARY_OP_TEMPLATE_MACRO(Extensions, ~)
 
+/**
+ * fastgltf can be built with a restricted extension set by defining FASTGLTF_ENABLED_EXTENSIONS
+ * to an Extensions bitmask, e.g.
+ * -DFASTGLTF_ENABLED_EXTENSIONS="fastgltf::Extensions::KHR_texture_transform | fastgltf::Extensions::KHR_mesh_quantization".
+ * The parsing code for every extension outside this set compiles down to nothing, and requesting
+ * such an extension on the Parser at runtime is ignored. Defaults to all extensions.
+ */
+#if !defined(FASTGLTF_ENABLED_EXTENSIONS)
+#define FASTGLTF_ENABLED_EXTENSIONS ~fastgltf::Extensions::None
+#endif
+
+	/**
+	 * The set of extensions fastgltf was compiled with support for, as configured through
+	 * FASTGLTF_ENABLED_EXTENSIONS.
+	 */
+	constexpr Extensions compiledExtensions = static_cast<Extensions>(FASTGLTF_ENABLED_EXTENSIONS);
+
+	/**
+	 * Returns whether support for the given extension was compiled in. As this is constexpr it
+	 * can be used with if constexpr to strip code paths for disabled extensions.
+	 */
+	constexpr bool isExtensionEnabled(Extensions extension) noexcept {
+		return (to_underlying(compiledExtensions) & to_underlying(extension)) == to_underlying(extension);
+	}
+
+	/**
+	 * Checks whether the given extension is enabled at runtime, but folds to a constant false
+	 * when the extension was compiled out through FASTGLTF_ENABLED_EXTENSIONS, which lets the
+	 * compiler drop the dependent parsing code entirely.
+	 */
+	template <Extensions extension>
+	constexpr bool hasCompiledBit(Extensions flags) noexcept {
+		if constexpr (isExtensionEnabled(extension)) {
+			return hasBit(flags, extension);
+		} else {
+			return false;
+		}
+	}
+
     // clang-format off
     enum class Options : std::uint64_t {
         None                            = 0,
@@ -203,6 +251,79 @@ namespace fastgltf {
          * to LoadExternalBuffers.
          */
         LoadExternalImages              = 1 << 7,
+
+        /**
+         * Parses the requested categories on multiple threads. The top-level glTF arrays are
+         * independent of each other, so each one can be handed to its own worker thread, which
+         * considerably reduces load latency for assets with many meshes and materials. Large
+         * base64-embedded buffers are also decoded with multiple threads with this option,
+         * unless a custom decode callback is set. Note that with this option any callbacks set
+         * on the Parser may be called from multiple threads simultaneously, and therefore have
+         * to be thread-safe.
+         */
+        ParallelParse                   = 1 << 8,
+
+        /**
+         * Decompresses buffer views compressed with EXT_meshopt_compression during the parse.
+         * The decoded bytes are stored in new buffers appended to the asset, and the compressed
+         * buffer views are rewritten to point at them, so that the rest of the application can
+         * treat the asset as if it was never compressed. With Options::ParallelParse the views
+         * are decompressed on multiple threads. This option requires fastgltf to be compiled
+         * with meshoptimizer, otherwise Error::MissingMeshoptimizer is returned.
+         */
+        DecodeMeshoptCompression        = 1 << 9,
+
+        /**
+         * Decompresses mesh primitives compressed with KHR_draco_mesh_compression during the
+         * parse. The decoded attribute and index data is stored in new buffers appended to the
+         * asset, and the accessors of the compressed primitives are rewritten to point at them.
+         * With Options::ParallelParse independent primitives are decompressed on multiple
+         * threads. This option requires fastgltf to be compiled with Draco, otherwise
+         * Error::MissingDraco is returned.
+         */
+        DecodeDracoCompression          = 1 << 10,
+
+        /**
+         * For every mesh primitive that has no index accessor, this deduplicates the vertices
+         * and synthesizes an index accessor, so that renderers can treat all primitives as
+         * indexed. The index data, and the compacted vertex data when duplicates were found, is
+         * stored in new buffers appended to the asset. Primitives with morph targets only get
+         * a trivial index buffer, as reordering their vertices would invalidate the targets.
+         * With Options::ParallelParse independent primitives are processed on multiple threads.
+         */
+        GenerateMeshIndices             = 1 << 11,
+
+        /**
+         * Expands every sparse accessor into a dense buffer appended to the asset, applying the
+         * sparse displacements once at load time, and clears Accessor::sparse. All subsequent
+         * reads through the accessor tools then take the contiguous fast path instead of the
+         * per-element sparse index lookup. With Options::ParallelParse independent accessors
+         * are expanded on multiple threads.
+         */
+        MaterializeSparseAccessors      = 1 << 12,
+
+        /**
+         * Skips the spec-conformance checks during parsing that are not required for safely
+         * extracting the data, such as the rule that accessors with float or unsigned int
+         * component types must not be normalized. Intended for first-party content that a
+         * trusted pipeline produces, where these rules are enforced at bake time; the checks
+         * can still be run explicitly through validate() afterwards. Checks that guard the
+         * extraction itself, like required fields and JSON types, always stay enabled.
+         */
+        TrustedInput                    = 1 << 13,
+
+        /**
+         * Memory-maps external buffer and image files instead of reading them into memory,
+         * referencing them as zero-copy ByteView spans into mappings that the Asset owns and
+         * releases with it. Each file is mapped independently on demand, so multi-buffer
+         * assets with binary payloads far beyond 2^32 bytes — the GLB chunk limit does not
+         * apply to external buffers — load without ever copying the data through a file
+         * stream, and the OS pages it in lazily. A file is only mapped whole, so on targets
+         * with a 32-bit address space very large buffers fall back to the copying read, which
+         * will then also fail; such assets require a 64-bit process. Only meaningful together
+         * with Options::LoadExternalBuffers and/or Options::LoadExternalImages.
+         */
+        MapExternalBuffers              = 1 << 14,
     };
     // clang-format on
 
@@ -216,6 +337,7 @@ namespace fastgltf {
     namespace extensions {
         constexpr std::string_view EXT_meshopt_compression = "EXT_meshopt_compression";
         constexpr std::string_view EXT_texture_webp = "EXT_texture_webp";
+        constexpr std::string_view KHR_draco_mesh_compression = "KHR_draco_mesh_compression";
         constexpr std::string_view KHR_lights_punctual = "KHR_lights_punctual";
         constexpr std::string_view KHR_materials_clearcoat = "KHR_materials_clearcoat";
         constexpr std::string_view KHR_materials_emissive_strength = "KHR_materials_emissive_strength";
@@ -236,9 +358,10 @@ namespace fastgltf {
 	// An array of pairs of string representations of extension identifiers and their respective enum
 	// value used for enabling/disabling the loading of it. This also represents all extensions that
 	// fastgltf supports and understands.
-	static constexpr std::array<std::pair<std::string_view, Extensions>, 16> extensionStrings = {{
+	static constexpr std::array<std::pair<std::string_view, Extensions>, 17> extensionStrings = {{
 		{ extensions::EXT_meshopt_compression,            Extensions::EXT_meshopt_compression },
 		{ extensions::EXT_texture_webp,                   Extensions::EXT_texture_webp },
+		{ extensions::KHR_draco_mesh_compression,         Extensions::KHR_draco_mesh_compression },
 		{ extensions::KHR_lights_punctual,                Extensions::KHR_lights_punctual },
 		{ extensions::KHR_materials_clearcoat,            Extensions::KHR_materials_clearcoat },
 		{ extensions::KHR_materials_emissive_strength,    Extensions::KHR_materials_emissive_strength },
@@ -285,11 +408,13 @@ namespace fastgltf {
 	}
 
 	class ChunkMemoryResource : public std::pmr::memory_resource {
+	public:
 		/**
 		 * The default size of the individual blocks we allocate.
 		 */
-		constexpr static std::size_t blockSize = 2048;
+		constexpr static std::size_t defaultBlockSize = 2048;
 
+	private:
 		struct Block {
 			std::unique_ptr<std::byte[]> data;
 			std::size_t size;
@@ -298,40 +423,82 @@ namespace fastgltf {
 		};
 		SmallVector<Block, 4> blocks;
 		std::size_t blockIdx = 0;
+		std::size_t totalAllocated = 0;
+
+		/**
+		 * Guards the block list, as with Options::ParallelParse multiple worker threads
+		 * allocate from this resource simultaneously. Uncontended, the lock only costs a few
+		 * nanoseconds per allocation.
+		 */
+		std::mutex mutex;
 
 	public:
-		explicit ChunkMemoryResource() {
-			allocateNewBlock();
+		/**
+		 * @param initialBlockSize The size of the first block, in bytes. Useful as a hint when the
+		 * rough string volume of the assets to parse is known upfront, as a single large block
+		 * avoids most of the follow-up block allocations. Defaults to the normal block size.
+		 */
+		explicit ChunkMemoryResource(std::size_t initialBlockSize = defaultBlockSize) {
+			allocateNewBlock(initialBlockSize);
 		}
 
-		void allocateNewBlock() {
+		void allocateNewBlock(std::size_t size = defaultBlockSize) {
 			auto& block = blocks.emplace_back();
-			block.data = std::unique_ptr<std::byte[]>(new std::byte[blockSize]);
+			block.data = std::unique_ptr<std::byte[]>(new std::byte[size]);
 			block.dataPointer = block.data.get();
-			block.size = blockSize;
+			block.size = size;
+		}
+
+		/**
+		 * Rewinds the resource to the beginning of its first block, keeping all blocks allocated
+		 * for reuse. This may only be called when no allocation made from this resource is alive
+		 * anymore, as the old memory gets handed out again.
+		 */
+		void reset() noexcept {
+			std::lock_guard<std::mutex> lock(mutex);
+			for (auto& block : blocks) {
+				block.dataPointer = block.data.get();
+			}
+			blockIdx = 0;
+			totalAllocated = 0;
+		}
+
+		/**
+		 * The total number of bytes handed out since construction or the last reset(), without
+		 * alignment padding. Only safe to read when no other thread is currently allocating.
+		 */
+		[[nodiscard]] std::size_t bytesAllocated() const noexcept {
+			return totalAllocated;
 		}
 
 		[[nodiscard]] void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+			std::lock_guard<std::mutex> lock(mutex);
+			return allocateFromBlocks(bytes, alignment);
+		}
+
+		[[nodiscard]] void* allocateFromBlocks(std::size_t bytes, std::size_t alignment) {
 			auto& block = blocks[blockIdx];
 			auto availableSize = block.dataPointer - block.data.get();
 			if ((availableSize + bytes) > block.size) {
-				// The block can't fit the new allocation. We'll just create a new block and use that.
-				allocateNewBlock();
-				++blockIdx;
-				return do_allocate(bytes, alignment);
+				// The block can't fit the new allocation. We'll advance to the next block, which
+				// after a reset() might already exist, and only allocate a new one otherwise.
+				if (++blockIdx == blocks.size())
+					allocateNewBlock();
+				return allocateFromBlocks(bytes, alignment);
 			}
 
 			void* alloc = block.dataPointer;
 			std::size_t space = availableSize;
 			if (std::align(alignment, availableSize, alloc, space) == nullptr) {
 				// Not enough space after alignment
-				allocateNewBlock();
-				++blockIdx;
-				return do_allocate(bytes, alignment);
+				if (++blockIdx == blocks.size())
+					allocateNewBlock();
+				return allocateFromBlocks(bytes, alignment);
 			}
 
 			// Get the number of bytes used for padding, and calculate the new offset using that
 			block.dataPointer = block.dataPointer + (availableSize - space) + bytes;
+			totalAllocated += bytes;
 			return alloc;
 		}
 
@@ -417,6 +584,74 @@ namespace fastgltf {
     using BufferUnmapCallback = void(BufferInfo* bufferInfo, void* userPointer);
     using Base64DecodeCallback = void(std::string_view base64, std::uint8_t* dataOutput, std::size_t padding, std::size_t dataOutputSize, void* userPointer);
 
+    /**
+     * Called whenever a category has been fully parsed, before loadGLTF returns. This allows
+     * consuming early categories while the rest of the asset is still being parsed, for example
+     * starting GPU uploads as soon as Category::Buffers is done. The asset pointer is only
+     * valid for the duration of the callback, and only the data of categories that have already
+     * completed may be accessed through it. With Options::ParallelParse the callback is invoked
+     * from the worker threads, possibly from multiple threads at once.
+     */
+    using CategoryCallback = void(Asset* asset, Category category, void* userPointer);
+
+    /**
+     * Called for every external file a buffer or image references, instead of fastgltf reading
+     * the file synchronously itself. The application should start reading byteLength bytes from
+     * the given file — possibly asynchronously through io_uring or DirectStorage — and return an
+     * application-chosen id the data will be referenced by through sources::CustomBuffer.
+     */
+    using BufferLoadCallback = CustomBufferId(const std::filesystem::path& path, std::uint64_t byteLength, void* userPointer);
+
+    /**
+     * Called once before a successful parse returns, after every external file has been handed
+     * to the BufferLoadCallback. The application has to wait here for its outstanding reads to
+     * finish. When parsing fails, this is not invoked, and the application keeps ownership of
+     * any requests that were already issued.
+     */
+    using BufferLoadJoinCallback = void(void* userPointer);
+
+// Compile-time switch for the load instrumentation below. Off by default, as even reading the
+// clock twice per phase is measurable on small assets.
+#if !defined(FASTGLTF_ENABLE_STATS)
+#define FASTGLTF_ENABLE_STATS 0
+#endif
+
+    /**
+     * Called for every timed section of a load when fastgltf was compiled with
+     * FASTGLTF_ENABLE_STATS, with a static name such as "json_parse", "base64_decode",
+     * "file_read", or the name of a category array. With Options::ParallelParse the callback
+     * is invoked from the worker threads, possibly from multiple threads at once.
+     */
+    using SpanCallback = void(std::string_view spanName, std::uint64_t nanoseconds, void* userPointer);
+
+    /**
+     * Timing and allocation statistics of the most recent load*GLTF call, retrieved through
+     * Parser::getLastLoadStats. All values stay zero unless fastgltf was compiled with
+     * FASTGLTF_ENABLE_STATS.
+     */
+    struct LoadStats {
+        /** Time simdjson spent parsing the document into its DOM, in nanoseconds. */
+        std::uint64_t jsonParseNanoseconds = 0;
+
+        /** Total time spent decoding base64 data URIs, in nanoseconds. */
+        std::uint64_t base64DecodeNanoseconds = 0;
+
+        /** The number of bytes produced by base64 decoding. */
+        std::uint64_t base64DecodedBytes = 0;
+
+        /** Total time spent reading external buffer and image files, in nanoseconds. */
+        std::uint64_t fileReadNanoseconds = 0;
+
+        /** The number of bytes the asset's string/vector arena handed out. */
+        std::uint64_t arenaBytesAllocated = 0;
+
+        /**
+         * Time each category's parse function took, in nanoseconds, indexed by the bit position
+         * of the category in the Category enum (e.g. Category::Buffers is element 0).
+         */
+        std::array<std::uint64_t, 13> categoryParseNanoseconds = {};
+    };
+
     /**
      * Enum to represent the type of a glTF file. glTFs can either be the standard JSON file with
      * paths to buffers or with a base64 embedded buffers, or they can be in a so called GLB
@@ -504,6 +739,124 @@ namespace fastgltf {
         }
     };
 
+    /**
+     * A GltfDataBuffer which memory-maps the file instead of reading it into a heap allocation,
+     * using mmap on POSIX systems and MapViewOfFile on Windows. This avoids the read-copy that
+     * loadFromFile performs and lets the OS page the data in lazily, which considerably lowers
+     * peak memory usage for large files. The padding simdjson requires is satisfied by the
+     * zeroed bytes between the end of the file and the end of the last mapped page; if the file
+     * ends too close to a page boundary for that guarantee to hold, or if the mapping fails,
+     * this falls back to the copying loadFromFile path transparently.
+     *
+     * Note that the mapping is read-only, so Options::MinimiseJsonBeforeParsing is skipped for
+     * this buffer. When parsing GLB files without Options::LoadGLBBuffers the BIN chunk is
+     * referenced as a zero-copy fastgltf::sources::ByteView into the mapping, meaning the
+     * buffer then has to outlive the Asset.
+     */
+    class MappedGltfDataBuffer : public GltfDataBuffer {
+        void* mapPointer = nullptr;
+        std::size_t mapLength = 0;
+
+#if defined(_WIN32)
+        // These are HANDLEs, stored as void* so this header doesn't have to include Windows headers.
+        void* fileHandle = nullptr;
+        void* fileMapping = nullptr;
+#else
+        int fileDescriptor = -1;
+#endif
+
+        void unmap() noexcept;
+
+    public:
+        explicit MappedGltfDataBuffer() noexcept = default;
+        ~MappedGltfDataBuffer() noexcept;
+
+        /**
+         * Memory-maps the file with an optional byte offset. Returns false if the file cannot
+         * be opened; when the platform refuses the mapping this copies the file contents using
+         * loadFromFile instead, so a true return does not guarantee a zero-copy mapping.
+         */
+        bool mapFromFile(const std::filesystem::path& path, std::uint64_t byteOffset = 0) noexcept;
+
+        /**
+         * Returns whether the buffer actually holds a file mapping, or whether it fell back to
+         * the copying loadFromFile path.
+         */
+        [[nodiscard]] bool isMapped() const noexcept {
+            return mapPointer != nullptr;
+        }
+    };
+
+    /**
+     * Incrementally assembles a GLB from a byte stream, so that parsing can overlap with the
+     * transfer when the source is unseekable, e.g. a network connection or a pipe. Feed the
+     * bytes in arrival order with feedBytes, using whatever chunk sizes the source delivers.
+     * Once canStartParse returns true the JSON chunk is fully buffered and the length of the
+     * BIN chunk is known, and the asset can be parsed with the GlbStream overload of
+     * Parser::loadBinaryGLTF while the rest of the BIN chunk is still streaming in.
+     *
+     * The parsed asset references the BIN chunk storage of this stream directly, like parsing
+     * a GLB without Options::LoadGLBBuffers does, so the stream has to outlive the asset.
+     * Buffer data must only be read once isComplete returns true.
+     */
+    class GlbStream {
+        friend class Parser;
+
+        enum class Stage : std::uint8_t {
+            Header,
+            JsonChunkHeader,
+            JsonChunk,
+            BinaryChunkHeader,
+            BinaryChunk,
+            Complete,
+        };
+
+        Stage stage = Stage::Header;
+
+        // Accumulates the fixed-size file and chunk headers when they arrive split across feeds.
+        std::array<std::uint8_t, 12> pending = {};
+        std::size_t pendingBytes = 0;
+
+        std::size_t totalLength = 0;
+        std::size_t consumedBytes = 0;
+        std::size_t jsonLength = 0;
+        std::size_t jsonBytesRead = 0;
+        std::size_t binaryLength = 0;
+        std::size_t binaryBytesRead = 0;
+        std::vector<std::uint8_t> jsonBytes;
+        std::vector<std::uint8_t> binaryBytes;
+
+    public:
+        /**
+         * Consumes the next byteCount bytes of the GLB stream. Returns Error::InvalidGLB as soon
+         * as the stream cannot be a valid GLB, e.g. on a wrong header magic or on bytes past the
+         * advertised file length; the stream is unusable after any error.
+         */
+        Error feedBytes(const std::uint8_t* bytes, std::size_t byteCount);
+
+        /**
+         * Returns whether enough of the stream has arrived to parse the asset, which is the case
+         * once the JSON chunk is fully buffered and the BIN chunk header, if any, has been read.
+         */
+        [[nodiscard]] bool canStartParse() const noexcept {
+            return stage == Stage::BinaryChunk || stage == Stage::Complete;
+        }
+
+        /**
+         * Returns whether all bytes advertised in the GLB header have been fed.
+         */
+        [[nodiscard]] bool isComplete() const noexcept {
+            return stage == Stage::Complete;
+        }
+
+        /**
+         * The number of BIN chunk bytes that have not arrived yet.
+         */
+        [[nodiscard]] std::size_t remainingBinaryBytes() const noexcept {
+            return binaryLength - binaryBytesRead;
+        }
+    };
+
     #if defined(__ANDROID__)
     class AndroidGltfDataBuffer : public GltfDataBuffer {
         AAssetManager* assetManager;
@@ -526,6 +879,10 @@ namespace fastgltf {
         BufferMapCallback* mapCallback = nullptr;
         BufferUnmapCallback* unmapCallback = nullptr;
         Base64DecodeCallback* decodeCallback = nullptr;
+        CategoryCallback* categoryCallback = nullptr;
+        BufferLoadCallback* loadCallback = nullptr;
+        BufferLoadJoinCallback* loadJoinCallback = nullptr;
+        SpanCallback* spanCallback = nullptr;
 
         void* userPointer = nullptr;
         Extensions extensions = Extensions::None;
@@ -540,11 +897,42 @@ namespace fastgltf {
     class Parser {
         // The simdjson parser object. We want to share it between runs, so it does not need to
         // reallocate over and over again. We're hiding it here to not leak the simdjson header.
+        //
+        // We deliberately use the dom API instead of the newer ondemand API. ondemand documents
+        // are forward-only cursors, but glTF objects cross-reference each other by index in
+        // arbitrary order, parse() dispatches the category arrays out of the order they appear in
+        // the document, and with Options::ParallelParse the retained dom::array handles are even
+        // consumed from worker threads. None of that works on a single-pass cursor, and the dom
+        // tape cost is amortised by the parser reuse above.
         std::unique_ptr<simdjson::dom::parser> jsonParser;
 
 		ParserInternalConfig config = {};
 		DataSource glbBuffer;
 		std::shared_ptr<ChunkMemoryResource> resourceAllocator;
+
+		// The atomic counterpart of LoadStats, as base64 decoding, file reads, and category
+		// parses record their times from worker threads with Options::ParallelParse. Only
+		// allocated when fastgltf was compiled with FASTGLTF_ENABLE_STATS.
+		struct LoadStatsCollector {
+			std::atomic<std::uint64_t> jsonParseNanoseconds = 0;
+			std::atomic<std::uint64_t> base64DecodeNanoseconds = 0;
+			std::atomic<std::uint64_t> base64DecodedBytes = 0;
+			std::atomic<std::uint64_t> fileReadNanoseconds = 0;
+			std::atomic<std::uint64_t> arenaBytesAllocated = 0;
+			std::array<std::atomic<std::uint64_t>, 13> categoryParseNanoseconds = {};
+
+			void reset() noexcept {
+				jsonParseNanoseconds = 0;
+				base64DecodeNanoseconds = 0;
+				base64DecodedBytes = 0;
+				fileReadNanoseconds = 0;
+				arenaBytesAllocated = 0;
+				for (auto& time : categoryParseNanoseconds)
+					time = 0;
+			}
+		};
+		std::unique_ptr<LoadStatsCollector> statsCollector;
+		std::size_t initialArenaSize = 0;
 		std::filesystem::path directory;
 		Options options;
 
@@ -552,7 +940,7 @@ namespace fastgltf {
 		static void fillCategories(Category& inputCategories) noexcept;
 
 		[[nodiscard]] auto decodeDataUri(URIView& uri) const noexcept -> Expected<DataSource>;
-		[[nodiscard]] auto loadFileFromUri(URIView& uri) const noexcept -> Expected<DataSource>;
+		[[nodiscard]] auto loadFileFromUri(URIView& uri, Asset& asset) const noexcept -> Expected<DataSource>;
 
 		Error parseAccessors(simdjson::dom::array& array, Asset& asset);
 		Error parseAnimations(simdjson::dom::array& array, Asset& asset);
@@ -569,10 +957,21 @@ namespace fastgltf {
 		Error parseScenes(simdjson::dom::array& array, Asset& asset);
 		Error parseSkins(simdjson::dom::array& array, Asset& asset);
 		Error parseTextures(simdjson::dom::array& array, Asset& asset);
+		// Only defined when fastgltf was compiled with meshoptimizer.
+		Error decodeMeshoptBufferViews(Asset& asset) const;
+		// Only defined when fastgltf was compiled with Draco.
+		Error decodeDracoPrimitives(Asset& asset) const;
+		Error generateMeshIndices(Asset& asset) const;
+		Error materializeSparseAccessors(Asset& asset) const;
 		Expected<Asset> parse(simdjson::dom::object root, Category categories);
 
     public:
-        explicit Parser(Extensions extensionsToLoad = Extensions::None) noexcept;
+		/**
+		 * @param extensionsToLoad The extensions the caller wants to make use of.
+		 * @param initialArenaSize An optional size hint, in bytes, for the first block of the memory
+		 * arena the asset's strings and small vectors get allocated from. 0 uses the default block size.
+		 */
+        explicit Parser(Extensions extensionsToLoad = Extensions::None, std::size_t initialArenaSize = 0) noexcept;
         explicit Parser(const Parser& parser) = delete;
         Parser(Parser&& parser) noexcept;
         Parser& operator=(const Parser& parser) = delete;
@@ -594,10 +993,25 @@ namespace fastgltf {
 		 */
 		[[nodiscard]] Expected<Asset> loadBinaryGLTF(GltfDataBuffer* buffer, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
 
+		/**
+		 * Loads a glTF file embedded within a GLB container that is still arriving through a
+		 * GlbStream, overlapping the parse with the transfer. Callable as soon as
+		 * GlbStream::canStartParse returns true. The BIN chunk is always referenced as a
+		 * fastgltf::sources::ByteView into the stream's storage — Options::LoadGLBBuffers is
+		 * ignored, as the bytes to copy may not have arrived yet — so the stream has to outlive
+		 * the returned Asset, and buffer data must only be read once GlbStream::isComplete
+		 * returns true.
+		 *
+		 * @return An Asset wrapped in an Expected type, which may contain an error if one occurred.
+		 */
+		[[nodiscard]] Expected<Asset> loadBinaryGLTF(GlbStream& stream, std::filesystem::path directory, Options options = Options::None, Category categories = Category::All);
+
 		/**
 		 * This function further validates all the input more strictly that is parsed from the glTF.
 		 * Realistically, this should not be necessary in Release applications, but could be helpful
-		 * when debugging an asset related issue.
+		 * when debugging an asset related issue. It also covers the spec rules that parsing skips
+		 * when Options::TrustedInput was specified. When the last load used Options::ParallelParse,
+		 * the independent object categories are validated on multiple threads.
 		*/
 		[[nodiscard]] Error validate(const Asset& asset) const;
 
@@ -630,6 +1044,101 @@ namespace fastgltf {
          * @param decodeCallback function called when the parser tries to decode a base64 buffer
          */
         void setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) noexcept;
+
+        /**
+         * Allows setting a callback that is invoked whenever a category has finished parsing,
+         * while the rest of the asset is potentially still being parsed. See
+         * fastgltf::CategoryCallback for the restrictions that apply to the callback.
+         * Using Parser::setUserPointer you can also set a user pointer to access your own class
+         * or other data you may need.
+         *
+         * @param categoryCallback function called when a category has been fully parsed, can be
+         * nullptr to remove a previously set callback.
+         */
+        void setCategoryCallback(CategoryCallback* categoryCallback) noexcept;
+
+        /**
+         * Allows the application to take over the reading of external buffer and image files,
+         * for example to overlap disk I/O with the JSON parse through io_uring or DirectStorage.
+         * Instead of reading a file itself, the parser passes its path and size to loadCallback
+         * and records the returned id as a sources::CustomBuffer; before a successful parse
+         * returns, joinCallback is invoked once so that the outstanding reads can be awaited.
+         * When a load callback is set, it takes precedence over the buffer allocation callbacks.
+         * Using Parser::setUserPointer you can also set a user pointer to access your own class
+         * or other data you may need.
+         *
+         * @param loadCallback function called for every external file, can be nullptr to remove
+         * a previously set callback.
+         * @param joinCallback function called once before a successful parse returns.
+         */
+        void setBufferLoadCallback(BufferLoadCallback* loadCallback, BufferLoadJoinCallback* joinCallback = nullptr) noexcept;
+
+        /**
+         * Allows setting a callback that receives one event per timed section of a load, for
+         * feeding a tracing or telemetry system. Only ever invoked when fastgltf was compiled
+         * with FASTGLTF_ENABLE_STATS; see fastgltf::SpanCallback for the threading caveats.
+         * Using Parser::setUserPointer you can also set a user pointer to access your own class
+         * or other data you may need.
+         *
+         * @param callback function called once per timed section, can be nullptr to remove a
+         * previously set callback.
+         */
+        void setSpanCallback(SpanCallback* callback) noexcept;
+
+        /**
+         * Returns the timing and allocation statistics collected during the most recent
+         * load*GLTF call. All values are zero unless fastgltf was compiled with
+         * FASTGLTF_ENABLE_STATS.
+         */
+        [[nodiscard]] LoadStats getLastLoadStats() const noexcept;
+
+        void setUserPointer(void* pointer) noexcept;
+    };
+
+    /**
+     * Called by ParserPool::loadAll on a worker thread as soon as one asset has finished
+     * loading, before the batch as a whole completes. index is the position of the file within
+     * the paths passed to loadAll. The callback may be invoked from multiple threads
+     * concurrently, but never twice for the same index.
+     */
+    using AssetLoadedCallback = void(std::size_t index, Expected<Asset>& result, void* userPointer);
+
+    /**
+     * Loads batches of glTF files across a pool of threads. Each worker owns one Parser that it
+     * reuses for every file it picks up, so the simdjson buffers and the preallocated memory
+     * arena stay warm across files instead of being recreated per asset — which dominates the
+     * cost when loading many small files. Workers pull the next unclaimed file from a shared
+     * counter, so large files don't stall the rest of the batch behind them.
+     *
+     * A single ParserPool may only run one loadAll batch at a time, but can run batches
+     * back-to-back and keeps its workers' parsers warm between them.
+     */
+    class ParserPool {
+        Extensions extensions;
+        std::size_t threadCount;
+
+        AssetLoadedCallback* loadedCallback = nullptr;
+        void* userPointer = nullptr;
+
+    public:
+        explicit ParserPool(Extensions extensionsToLoad = Extensions::None,
+                std::size_t threadCount = std::thread::hardware_concurrency()) noexcept;
+
+        /**
+         * Loads every file in paths, GLB or JSON-based alike, and returns the results in the
+         * same order. The call blocks until the whole batch has finished; use the
+         * AssetLoadedCallback to consume assets as they complete. The directory of each file is
+         * used for resolving its external buffers and images.
+         */
+        [[nodiscard]] std::vector<Expected<Asset>> loadAll(const std::vector<std::filesystem::path>& paths,
+                Options options = Options::None, Category categories = Category::All);
+
+        /**
+         * Sets a callback invoked from the worker threads once per finished asset, or nullptr
+         * to remove a previously set callback.
+         */
+        void setAssetLoadedCallback(AssetLoadedCallback* callback) noexcept;
+
         void setUserPointer(void* pointer) noexcept;
     };
 } // namespace fastgltf
@@ -26,11 +26,34 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cstring>
 #include <iterator>
+#include <limits>
+#include <thread>
+#include <vector>
 
 #include "types.hpp"
 
+// Same architecture detection as base64.hpp; guarded so that both headers can be included in
+// any order.
+#if !defined(FASTGLTF_IS_X86) && !defined(FASTGLTF_IS_A64)
+#if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
+#define FASTGLTF_IS_X86
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define FASTGLTF_IS_A64
+#endif
+#endif
+
+// The bulk conversion kernels below only need the baseline SIMD instruction set of either
+// architecture (SSE2 on x86-64, Neon on A64), so no runtime dispatch is required.
+#if defined(FASTGLTF_IS_X86)
+#include <emmintrin.h>
+#elif defined(FASTGLTF_IS_A64)
+#include <arm_neon.h>
+#endif
+
 namespace fastgltf {
 
 template <typename>
@@ -243,6 +266,151 @@ inline bool findSparseIndex(ComponentType componentType, const std::byte* bytes,
 	return false;
 }
 
+// Bulk conversion kernels for the component conversions that dominate when ingesting quantized
+// (KHR_mesh_quantization) assets. They convert a contiguous run of components at once, so they
+// can only be used when both the source and the destination are tightly packed; copyFromAccessor
+// checks for that. The scalar tails reuse convertComponent.
+#if defined(FASTGLTF_IS_X86)
+inline void convertComponentsU8ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = _mm_set1_ps(normalized ? 1.0f / 255.0f : 1.0f);
+	const auto zero = _mm_setzero_si128();
+	std::size_t i = 0;
+	for (; i + 16 <= count; i += 16) {
+		auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		auto lo = _mm_unpacklo_epi8(in, zero);
+		auto hi = _mm_unpackhi_epi8(in, zero);
+		_mm_storeu_ps(dst + i +  0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), scale));
+		_mm_storeu_ps(dst + i +  4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), scale));
+		_mm_storeu_ps(dst + i +  8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), scale));
+		_mm_storeu_ps(dst + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), scale));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint8_t, float, 0>(src + i, normalized);
+}
+
+inline void convertComponentsU16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = _mm_set1_ps(normalized ? 1.0f / 65535.0f : 1.0f);
+	const auto zero = _mm_setzero_si128();
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(std::uint16_t)));
+		_mm_storeu_ps(dst + i + 0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(in, zero)), scale));
+		_mm_storeu_ps(dst + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(in, zero)), scale));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, float, 0>(src + i * sizeof(std::uint16_t), normalized);
+}
+
+inline void convertComponentsS16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = _mm_set1_ps(normalized ? 1.0f / 32767.0f : 1.0f);
+	const auto lowest = _mm_set1_ps(-1.0f);
+	const auto zero = _mm_setzero_si128();
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(std::int16_t)));
+		// Unpacking into the upper half and shifting back down sign-extends without SSE4.1.
+		auto lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(zero, in), 16)), scale);
+		auto hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(zero, in), 16)), scale);
+		if (normalized) {
+			// -32768 and -32767 both have to map to -1.0.
+			lo = _mm_max_ps(lo, lowest);
+			hi = _mm_max_ps(hi, lowest);
+		}
+		_mm_storeu_ps(dst + i + 0, lo);
+		_mm_storeu_ps(dst + i + 4, hi);
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::int16_t, float, 0>(src + i * sizeof(std::int16_t), normalized);
+}
+
+inline void convertComponentsU16ToU32(const std::byte* src, std::uint32_t* dst, std::size_t count) {
+	const auto zero = _mm_setzero_si128();
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * sizeof(std::uint16_t)));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 0), _mm_unpacklo_epi16(in, zero));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 4), _mm_unpackhi_epi16(in, zero));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, std::uint32_t, 0>(src + i * sizeof(std::uint16_t), false);
+}
+#elif defined(FASTGLTF_IS_A64)
+inline void convertComponentsU8ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = normalized ? 1.0f / 255.0f : 1.0f;
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = vmovl_u8(vld1_u8(reinterpret_cast<const std::uint8_t*>(src + i)));
+		vst1q_f32(dst + i + 0, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(in))), scale));
+		vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(in))), scale));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint8_t, float, 0>(src + i, normalized);
+}
+
+inline void convertComponentsU16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = normalized ? 1.0f / 65535.0f : 1.0f;
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src + i * sizeof(std::uint16_t)));
+		vst1q_f32(dst + i + 0, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(in))), scale));
+		vst1q_f32(dst + i + 4, vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(in))), scale));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, float, 0>(src + i * sizeof(std::uint16_t), normalized);
+}
+
+inline void convertComponentsS16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	const auto scale = normalized ? 1.0f / 32767.0f : 1.0f;
+	const auto lowest = vdupq_n_f32(-1.0f);
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = vld1q_s16(reinterpret_cast<const std::int16_t*>(src + i * sizeof(std::int16_t)));
+		auto lo = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(in))), scale);
+		auto hi = vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(in))), scale);
+		if (normalized) {
+			// -32768 and -32767 both have to map to -1.0.
+			lo = vmaxq_f32(lo, lowest);
+			hi = vmaxq_f32(hi, lowest);
+		}
+		vst1q_f32(dst + i + 0, lo);
+		vst1q_f32(dst + i + 4, hi);
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::int16_t, float, 0>(src + i * sizeof(std::int16_t), normalized);
+}
+
+inline void convertComponentsU16ToU32(const std::byte* src, std::uint32_t* dst, std::size_t count) {
+	std::size_t i = 0;
+	for (; i + 8 <= count; i += 8) {
+		auto in = vld1q_u16(reinterpret_cast<const std::uint16_t*>(src + i * sizeof(std::uint16_t)));
+		vst1q_u32(dst + i + 0, vmovl_u16(vget_low_u16(in)));
+		vst1q_u32(dst + i + 4, vmovl_u16(vget_high_u16(in)));
+	}
+	for (; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, std::uint32_t, 0>(src + i * sizeof(std::uint16_t), false);
+}
+#else
+inline void convertComponentsU8ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	for (std::size_t i = 0; i < count; ++i)
+		dst[i] = convertComponent<std::uint8_t, float, 0>(src + i, normalized);
+}
+
+inline void convertComponentsU16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	for (std::size_t i = 0; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, float, 0>(src + i * sizeof(std::uint16_t), normalized);
+}
+
+inline void convertComponentsS16ToF32(const std::byte* src, float* dst, std::size_t count, bool normalized) {
+	for (std::size_t i = 0; i < count; ++i)
+		dst[i] = convertComponent<std::int16_t, float, 0>(src + i * sizeof(std::int16_t), normalized);
+}
+
+inline void convertComponentsU16ToU32(const std::byte* src, std::uint32_t* dst, std::size_t count) {
+	for (std::size_t i = 0; i < count; ++i)
+		dst[i] = convertComponent<std::uint16_t, std::uint32_t, 0>(src + i * sizeof(std::uint16_t), false);
+}
+#endif
+
 } // namespace internal
 
 struct DefaultBufferDataAdapter {
@@ -261,6 +429,50 @@ struct DefaultBufferDataAdapter {
 	}
 };
 
+/**
+ * A pre-resolved view over the data of a non-sparse accessor. All the per-call resolution work
+ * of the accessor tools — looking up the BufferView, visiting the DataSource variant through the
+ * adapter, and deriving the stride — is done once by prepareAccessor, so reading the same
+ * accessor repeatedly (CPU skinning, per-frame collision mesh refresh) only pays for the
+ * component conversion itself.
+ */
+struct AccessorLayout {
+	/** Points at the first element. nullptr when the accessor has no buffer view, in which case every element reads as zeros. */
+	const std::byte* base = nullptr;
+	std::size_t stride = 0;
+	std::size_t count = 0;
+	ComponentType componentType = ComponentType::Invalid;
+	AccessorType type = AccessorType::Invalid;
+	bool normalized = false;
+};
+
+/**
+ * Resolves the layout of a non-sparse accessor once, for use with the AccessorLayout overloads
+ * of getAccessorElement, iterateAccessor, and copyFromAccessor. The layout stays valid for as
+ * long as the buffer data the adapter returned does. Sparse accessors cannot be flattened into
+ * a single pointer and stride; keep using the Asset-based overloads for those.
+ */
+template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+AccessorLayout prepareAccessor(const Asset& asset, const Accessor& accessor, const BufferDataAdapter& adapter = {}) {
+	assert(!accessor.sparse.has_value() || accessor.sparse->count == 0);
+
+	AccessorLayout layout;
+	layout.count = accessor.count;
+	layout.componentType = accessor.componentType;
+	layout.type = accessor.type;
+	layout.normalized = accessor.normalized;
+
+	// 5.1.1. accessor.bufferView
+	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
+	// property or extensions MAY override zeros with actual values.
+	if (accessor.bufferViewIndex) {
+		const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+		layout.stride = view.byteStride ? *view.byteStride : getElementByteSize(accessor.type, accessor.componentType);
+		layout.base = adapter(asset.buffers[view.bufferIndex]) + view.byteOffset + accessor.byteOffset;
+	}
+	return layout;
+}
+
 template <typename ElementType, typename BufferDataAdapter>
 class IterableAccessor;
 
@@ -455,6 +667,25 @@ ElementType getAccessorElement(const Asset& asset, const Accessor& accessor, siz
 	return internal::getAccessorElementAt<ElementType>(accessor.componentType, bytes + index * stride, accessor.normalized);
 }
 
+template <typename ElementType>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+ElementType getAccessorElement(const AccessorLayout& layout, std::size_t index) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid Accessor Type");
+
+	if (layout.base == nullptr) {
+		if constexpr (std::is_aggregate_v<ElementType>) {
+			return {};
+		} else {
+			return ElementType{};
+		}
+	}
+
+	return internal::getAccessorElementAt<ElementType>(layout.componentType, layout.base + index * layout.stride, layout.normalized);
+}
+
 template<typename ElementType, typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType>
@@ -555,6 +786,30 @@ void iterateAccessor(const Asset& asset, const Accessor& accessor, Functor&& fun
 	}
 }
 
+template <typename ElementType, typename Functor>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void iterateAccessor(const AccessorLayout& layout, Functor&& func) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+
+	if (layout.type != Traits::type) {
+		return;
+	}
+
+	if (layout.base == nullptr) {
+		for (std::size_t i = 0; i < layout.count; ++i) {
+			func(ElementType{});
+		}
+	} else {
+		for (std::size_t i = 0; i < layout.count; ++i) {
+			func(internal::getAccessorElementAt<ElementType>(layout.componentType, layout.base + i * layout.stride, layout.normalized));
+		}
+	}
+}
+
 template <typename ElementType, typename Functor, typename BufferDataAdapter = DefaultBufferDataAdapter>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType>
@@ -567,13 +822,11 @@ void iterateAccessorWithIndex(const Asset& asset, const Accessor& accessor, Func
 	}, adapter);
 }
 
-template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
-		 typename BufferDataAdapter = DefaultBufferDataAdapter>
+template <typename ElementType, std::size_t TargetStride = sizeof(ElementType)>
 #if FASTGLTF_HAS_CONCEPTS
 requires Element<ElementType>
 #endif
-void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
-		const BufferDataAdapter& adapter = {}) {
+void copyFromAccessor(const AccessorLayout& layout, void* dest) {
 	using Traits = ElementTraits<ElementType>;
 	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
 	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
@@ -581,35 +834,25 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
 	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
 
-	if (accessor.type != Traits::type) {
+	if (layout.type != Traits::type) {
 		return;
 	}
 
 	auto* dstBytes = reinterpret_cast<std::byte*>(dest);
 
-	if (accessor.sparse && accessor.sparse->count > 0) {
-		return iterateAccessorWithIndex<ElementType>(asset, accessor, [&](auto&& value, std::size_t index) {
-			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * index);
-			*pDest = std::forward<ElementType>(value);
-		}, adapter);
-	}
+	auto elemSize = getElementByteSize(layout.type, layout.componentType);
 
-	auto elemSize = getElementByteSize(accessor.type, accessor.componentType);
-
-	// 5.1.1. accessor.bufferView
-	// The index of the buffer view. When undefined, the accessor MUST be initialized with zeros; sparse
-	// property or extensions MAY override zeros with actual values.
-	if (!accessor.bufferViewIndex) {
+	if (layout.base == nullptr) {
 		if constexpr (std::is_trivially_copyable_v<ElementType>) {
 			if (TargetStride == elemSize) {
-				std::memset(dest, 0, elemSize * accessor.count);
+				std::memset(dest, 0, elemSize * layout.count);
 			} else {
-				for (std::size_t i = 0; i < accessor.count; ++i) {
+				for (std::size_t i = 0; i < layout.count; ++i) {
 					std::memset(dstBytes + i * TargetStride, 0, elemSize);
 				}
 			}
 		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
+			for (std::size_t i = 0; i < layout.count; ++i) {
 				auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
 
 				if constexpr (std::is_aggregate_v<ElementType>) {
@@ -623,28 +866,625 @@ void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
 		return;
 	}
 
-	auto& view = asset.bufferViews[*accessor.bufferViewIndex];
-	auto srcStride = view.byteStride ? *view.byteStride
-			: getElementByteSize(accessor.type, accessor.componentType);
-
-	auto* srcBytes = adapter(asset.buffers[view.bufferIndex]) + view.byteOffset + accessor.byteOffset;
+	auto srcStride = layout.stride;
+	auto* srcBytes = layout.base;
 
 	// We have to perform normalization if the accessor is marked as containing normalized data, which is why
 	// we can't just memcpy then.
-	if (std::is_trivially_copyable_v<ElementType> && !accessor.normalized && accessor.componentType == Traits::enum_component_type) {
+	if (std::is_trivially_copyable_v<ElementType> && !layout.normalized && layout.componentType == Traits::enum_component_type) {
 		if (srcStride == elemSize && srcStride == TargetStride) {
-			std::memcpy(dest, srcBytes, elemSize * accessor.count);
+			std::memcpy(dest, srcBytes, elemSize * layout.count);
 		} else {
-			for (std::size_t i = 0; i < accessor.count; ++i) {
+			for (std::size_t i = 0; i < layout.count; ++i) {
 				std::memcpy(dstBytes + TargetStride * i, srcBytes + srcStride * i, elemSize);
 			}
 		}
 	} else {
-		for (std::size_t i = 0; i < accessor.count; ++i) {
+		using DestType = typename Traits::component_type;
+		constexpr auto numComponents = getNumComponents(Traits::type);
+
+		// When both sides are tightly packed, the whole accessor is just one contiguous run of
+		// components, which the SIMD kernels above convert in bulk. These cover the conversions
+		// quantized (KHR_mesh_quantization) assets need most.
+		if constexpr (std::is_trivially_copyable_v<ElementType>
+				&& sizeof(ElementType) == numComponents * sizeof(DestType)
+				&& TargetStride == sizeof(ElementType)
+				&& (std::is_same_v<DestType, float> || std::is_same_v<DestType, std::uint32_t>)) {
+			if (srcStride == elemSize) {
+				const auto componentCount = layout.count * numComponents;
+				auto* dstComponents = reinterpret_cast<DestType*>(dstBytes);
+				if constexpr (std::is_same_v<DestType, float>) {
+					switch (layout.componentType) {
+						case ComponentType::UnsignedByte:
+							internal::convertComponentsU8ToF32(srcBytes, dstComponents, componentCount, layout.normalized);
+							return;
+						case ComponentType::UnsignedShort:
+							internal::convertComponentsU16ToF32(srcBytes, dstComponents, componentCount, layout.normalized);
+							return;
+						case ComponentType::Short:
+							internal::convertComponentsS16ToF32(srcBytes, dstComponents, componentCount, layout.normalized);
+							return;
+						default:
+							break;
+					}
+				} else {
+					if (layout.componentType == ComponentType::UnsignedShort && !layout.normalized) {
+						internal::convertComponentsU16ToU32(srcBytes, dstComponents, componentCount);
+						return;
+					}
+				}
+			}
+		}
+
+		for (std::size_t i = 0; i < layout.count; ++i) {
 			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * i);
-			*pDest = internal::getAccessorElementAt<ElementType>(accessor.componentType, srcBytes + srcStride * i);
+			*pDest = internal::getAccessorElementAt<ElementType>(layout.componentType, srcBytes + srcStride * i, layout.normalized);
+		}
+	}
+}
+
+template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
+		 typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void copyFromAccessor(const Asset& asset, const Accessor& accessor, void* dest,
+		const BufferDataAdapter& adapter = {}) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+	static_assert(std::is_default_constructible_v<ElementType>, "Element type must be default constructible");
+	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
+	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
+
+	if (accessor.type != Traits::type) {
+		return;
+	}
+
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		auto* dstBytes = reinterpret_cast<std::byte*>(dest);
+		return iterateAccessorWithIndex<ElementType>(asset, accessor, [&](auto&& value, std::size_t index) {
+			auto* pDest = reinterpret_cast<ElementType*>(dstBytes + TargetStride * index);
+			*pDest = std::forward<ElementType>(value);
+		}, adapter);
+	}
+
+	// The non-sparse path is identical to copying from a prepared layout.
+	copyFromAccessor<ElementType, TargetStride>(prepareAccessor(asset, accessor, adapter), dest);
+}
+
+/**
+ * Like copyFromAccessor, but partitions the element range across up to threadCount threads for
+ * strided or converting copies. Each thread runs the serial copy over its own slice of the
+ * layout, so the memcpy and SIMD bulk conversion fast paths apply per slice. Copies that boil
+ * down to one contiguous memcpy, and ranges too small to amortize thread startup, stay on the
+ * calling thread. Sparse accessors are always copied serially, as their scatter writes to
+ * unpredictable destination offsets.
+ */
+template <typename ElementType, std::size_t TargetStride = sizeof(ElementType),
+		 typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires Element<ElementType>
+#endif
+void copyFromAccessorParallel(const Asset& asset, const Accessor& accessor, void* dest,
+		std::size_t threadCount = std::thread::hardware_concurrency(), const BufferDataAdapter& adapter = {}) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+	static_assert(std::is_default_constructible_v<ElementType>, "Element type must be default constructible");
+	static_assert(std::is_constructible_v<ElementType>, "Element type must be constructible");
+	static_assert(std::is_move_assignable_v<ElementType>, "Element type must be move-assignable");
+
+	if (accessor.type != Traits::type) {
+		return;
+	}
+
+	if (accessor.sparse && accessor.sparse->count > 0) {
+		return copyFromAccessor<ElementType, TargetStride>(asset, accessor, dest, adapter);
+	}
+
+	auto layout = prepareAccessor(asset, accessor, adapter);
+
+	constexpr std::size_t minElementsPerThread = 16384;
+	auto elemSize = getElementByteSize(layout.type, layout.componentType);
+	auto contiguousMemcpy = std::is_trivially_copyable_v<ElementType> && !layout.normalized
+			&& layout.componentType == Traits::enum_component_type
+			&& layout.stride == elemSize && TargetStride == elemSize;
+	if (threadCount <= 1 || layout.base == nullptr || contiguousMemcpy
+			|| layout.count < 2 * minElementsPerThread) {
+		return copyFromAccessor<ElementType, TargetStride>(layout, dest);
+	}
+
+	if (auto maxThreads = layout.count / minElementsPerThread; threadCount > maxThreads)
+		threadCount = maxThreads;
+
+	auto copyRange = [&layout, dest](std::size_t first, std::size_t count) {
+		auto slice = layout;
+		slice.base = layout.base + first * layout.stride;
+		slice.count = count;
+		copyFromAccessor<ElementType, TargetStride>(slice, reinterpret_cast<std::byte*>(dest) + first * TargetStride);
+	};
+
+	SmallVector<std::thread, 8> workers;
+	workers.reserve(threadCount - 1);
+	std::size_t first = 0;
+	for (std::size_t i = 0; i < threadCount; ++i) {
+		auto count = layout.count / threadCount + (i < layout.count % threadCount ? 1 : 0);
+		if (i + 1 == threadCount) {
+			// The last slice runs on the calling thread instead of it only waiting.
+			copyRange(first, count);
+		} else {
+			workers.emplace_back(copyRange, first, count);
+		}
+		first += count;
+	}
+	for (auto& worker : workers) {
+		worker.join();
+	}
+}
+
+/**
+ * Describes one attribute of an interleaved copy: which accessor to read from, and at which
+ * byte offset inside a single destination vertex its element gets written.
+ */
+struct InterleavedCopyDesc {
+	const Accessor* accessor;
+	std::size_t destByteOffset;
+};
+
+namespace internal {
+
+template <typename ElementType, typename BufferDataAdapter>
+bool prepareInterleavedAttribute(const Asset& asset, const InterleavedCopyDesc& desc, std::byte* dest,
+		std::size_t destStride, std::size_t count, AccessorLayout& layout, const BufferDataAdapter& adapter) {
+	using Traits = ElementTraits<ElementType>;
+	static_assert(Traits::type != AccessorType::Invalid, "Accessor traits must provide a valid accessor type");
+	static_assert(Traits::enum_component_type != ComponentType::Invalid, "Accessor traits must provide a valid component type");
+
+	if (desc.accessor->type != Traits::type) {
+		return false;
+	}
+
+	// Sparse accessors cannot be flattened into a layout, so this attribute gets its own
+	// strided copy upfront instead of joining the lockstep pass.
+	if (desc.accessor->sparse && desc.accessor->sparse->count > 0) {
+		iterateAccessorWithIndex<ElementType>(asset, *desc.accessor, [&](auto&& value, std::size_t index) {
+			if (index < count) {
+				auto* pDest = reinterpret_cast<ElementType*>(dest + index * destStride + desc.destByteOffset);
+				*pDest = std::forward<ElementType>(value);
+			}
+		}, adapter);
+		return false;
+	}
+
+	layout = prepareAccessor(asset, *desc.accessor, adapter);
+	return true;
+}
+
+template <typename... ElementTypes, typename BufferDataAdapter, std::size_t... I>
+void copyInterleavedImpl(const Asset& asset, const std::array<InterleavedCopyDesc, sizeof...(ElementTypes)>& descs,
+		std::byte* dest, std::size_t destStride, std::size_t count, const BufferDataAdapter& adapter,
+		std::index_sequence<I...>) {
+	std::array<AccessorLayout, sizeof...(ElementTypes)> layouts = {};
+	std::array<bool, sizeof...(ElementTypes)> lockstep = {};
+	((lockstep[I] = prepareInterleavedAttribute<ElementTypes>(asset, descs[I], dest, destStride, count,
+			layouts[I], adapter)), ...);
+
+	for (std::size_t i = 0; i < count; ++i) {
+		auto* vertex = dest + i * destStride;
+		((lockstep[I]
+				? void(*reinterpret_cast<ElementTypes*>(vertex + descs[I].destByteOffset)
+						= getAccessorElement<ElementTypes>(layouts[I], i))
+				: void()), ...);
+	}
+}
+
+} // namespace internal
+
+/**
+ * Copies multiple accessors in lockstep into one interleaved destination, e.g. a persistently
+ * mapped vertex staging buffer. One ElementType has to be given per desc, in the same order;
+ * each element is converted like getAccessorElement and written to
+ * dest + i * destStride + destByteOffset, so position, normal, and UV land in their final
+ * vertex layout in a single pass over the destination instead of one strided pass per
+ * attribute. The copy stops after the smallest accessor count. Attributes whose accessor type
+ * doesn't match their ElementType are skipped, like copyFromAccessor skips them. Sparse
+ * accessors can't join the lockstep walk and are copied with their own strided pass.
+ */
+template <typename... ElementTypes, typename BufferDataAdapter = DefaultBufferDataAdapter>
+#if FASTGLTF_HAS_CONCEPTS
+requires (Element<ElementTypes> && ...)
+#endif
+void copyInterleaved(const Asset& asset, const std::array<InterleavedCopyDesc, sizeof...(ElementTypes)>& descs,
+		void* dest, std::size_t destStride, const BufferDataAdapter& adapter = {}) {
+	static_assert(sizeof...(ElementTypes) > 0, "At least one attribute is needed for an interleaved copy");
+
+	auto count = std::numeric_limits<std::size_t>::max();
+	for (const auto& desc : descs) {
+		count = std::min(count, desc.accessor->count);
+	}
+
+	internal::copyInterleavedImpl<ElementTypes...>(asset, descs, reinterpret_cast<std::byte*>(dest),
+			destStride, count, adapter, std::make_index_sequence<sizeof...(ElementTypes)>());
+}
+
+namespace internal {
+
+inline float convertComponentToFloat(ComponentType componentType, const std::byte* bytes, bool normalized) {
+	switch (componentType) {
+		case ComponentType::Byte:
+			return convertComponent<std::int8_t, float, 0>(bytes, normalized);
+		case ComponentType::UnsignedByte:
+			return convertComponent<std::uint8_t, float, 0>(bytes, normalized);
+		case ComponentType::Short:
+			return convertComponent<std::int16_t, float, 0>(bytes, normalized);
+		case ComponentType::UnsignedShort:
+			return convertComponent<std::uint16_t, float, 0>(bytes, normalized);
+		case ComponentType::Int:
+			return convertComponent<std::int32_t, float, 0>(bytes, normalized);
+		case ComponentType::UnsignedInt:
+			return convertComponent<std::uint32_t, float, 0>(bytes, normalized);
+		case ComponentType::Float:
+			return convertComponent<float, float, 0>(bytes, normalized);
+		case ComponentType::Double:
+			return convertComponent<double, float, 0>(bytes, normalized);
+		case ComponentType::Invalid:
+		default:
+			return 0.0f;
+	}
+}
+
+} // namespace internal
+
+/**
+ * A time-sorted structure-of-arrays copy of one animation sampler's keyframes. The input times
+ * and output values live in two packed float arrays, so per-frame sampling is a binary search
+ * plus a linear read instead of a component conversion per accessor element.
+ */
+struct AnimationSamplerCache {
+	std::vector<float> times;
+	std::vector<float> values;
+
+	/**
+	 * The number of floats each keyframe occupies in values. For cubic spline samplers this
+	 * includes the in-tangent and out-tangent elements, so it is three times the component
+	 * count of the output elements.
+	 */
+	std::size_t valuesPerKeyframe = 0;
+	AnimationInterpolation interpolation = AnimationInterpolation::Linear;
+};
+
+/**
+ * The packed keyframe data of every sampler of one animation, parallel to Animation::samplers.
+ * Build it once with prepareAnimation after parsing, then sample it every frame with
+ * evaluateAnimation.
+ */
+struct AnimationCache {
+	std::vector<AnimationSamplerCache> samplers;
+};
+
+/**
+ * Converts the input and output accessors of every sampler of the given animation into packed
+ * float arrays. The keyframes are sorted by time, which the glTF spec already requires but
+ * real-world assets don't always honour. Sparse output accessors are not supported.
+ */
+template <typename BufferDataAdapter = DefaultBufferDataAdapter>
+AnimationCache prepareAnimation(const Asset& asset, std::size_t animationIndex, const BufferDataAdapter& adapter = {}) {
+	assert(animationIndex < asset.animations.size());
+	const auto& animation = asset.animations[animationIndex];
+
+	AnimationCache cache;
+	cache.samplers.reserve(animation.samplers.size());
+	for (const auto& sampler : animation.samplers) {
+		auto& cached = cache.samplers.emplace_back();
+		cached.interpolation = sampler.interpolation;
+
+		const auto& input = asset.accessors[sampler.inputAccessor];
+		const auto& output = asset.accessors[sampler.outputAccessor];
+		if (input.count == 0)
+			continue;
+
+		cached.times.resize(input.count);
+		copyFromAccessor<float>(asset, input, cached.times.data(), adapter);
+
+		auto layout = prepareAccessor(asset, output, adapter);
+		auto componentCount = static_cast<std::size_t>(getNumComponents(layout.type));
+		cached.valuesPerKeyframe = (output.count / input.count) * componentCount;
+		cached.values.resize(input.count * cached.valuesPerKeyframe);
+		if (layout.base != nullptr) {
+			auto componentSize = static_cast<std::size_t>(getComponentBitSize(layout.componentType)) / 8;
+			for (std::size_t i = 0; i < output.count; ++i) {
+				const auto* element = layout.base + i * layout.stride;
+				for (std::size_t c = 0; c < componentCount; ++c) {
+					cached.values[i * componentCount + c] =
+							internal::convertComponentToFloat(layout.componentType, element + c * componentSize, layout.normalized);
+				}
+			}
+		}
+
+		if (!std::is_sorted(cached.times.begin(), cached.times.end())) {
+			std::vector<std::uint32_t> order(cached.times.size());
+			for (std::size_t i = 0; i < order.size(); ++i)
+				order[i] = static_cast<std::uint32_t>(i);
+			std::sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) {
+				return cached.times[a] < cached.times[b];
+			});
+
+			std::vector<float> sortedTimes(cached.times.size());
+			std::vector<float> sortedValues(cached.values.size());
+			for (std::size_t i = 0; i < order.size(); ++i) {
+				sortedTimes[i] = cached.times[order[i]];
+				std::memcpy(sortedValues.data() + i * cached.valuesPerKeyframe,
+						cached.values.data() + static_cast<std::size_t>(order[i]) * cached.valuesPerKeyframe,
+						cached.valuesPerKeyframe * sizeof(float));
+			}
+			cached.times = std::move(sortedTimes);
+			cached.values = std::move(sortedValues);
+		}
+	}
+	return cache;
+}
+
+/**
+ * Samples a cached animation sampler at the given time and writes up to outCount interpolated
+ * floats. The time is clamped to the keyframe range. Components are interpolated independently;
+ * use sampleAnimationRotation for quaternion outputs.
+ */
+inline void sampleAnimationSampler(const AnimationSamplerCache& sampler, float time, float* out, std::size_t outCount) {
+	auto cubic = sampler.interpolation == AnimationInterpolation::CubicSpline;
+	auto stride = sampler.valuesPerKeyframe;
+	auto componentCount = cubic ? stride / 3 : stride;
+	auto count = outCount < componentCount ? outCount : componentCount;
+	if (sampler.times.empty() || count == 0) {
+		for (std::size_t c = 0; c < outCount; ++c)
+			out[c] = 0.0f;
+		return;
+	}
+
+	// For cubic spline keyframes the actual value sits between the in-tangent and out-tangent.
+	auto valueOffset = cubic ? componentCount : 0;
+	if (time <= sampler.times.front()) {
+		std::memcpy(out, sampler.values.data() + valueOffset, count * sizeof(float));
+		return;
+	}
+	if (time >= sampler.times.back()) {
+		std::memcpy(out, sampler.values.data() + (sampler.times.size() - 1) * stride + valueOffset, count * sizeof(float));
+		return;
+	}
+
+	auto next = static_cast<std::size_t>(std::upper_bound(sampler.times.begin(), sampler.times.end(), time) - sampler.times.begin());
+	auto prev = next - 1;
+	auto dt = sampler.times[next] - sampler.times[prev];
+	auto u = dt > 0.0f ? (time - sampler.times[prev]) / dt : 0.0f;
+
+	const auto* v0 = sampler.values.data() + prev * stride;
+	const auto* v1 = sampler.values.data() + next * stride;
+	switch (sampler.interpolation) {
+		case AnimationInterpolation::Step: {
+			std::memcpy(out, v0, count * sizeof(float));
+			break;
+		}
+		case AnimationInterpolation::Linear: {
+			for (std::size_t c = 0; c < count; ++c)
+				out[c] = v0[c] + (v1[c] - v0[c]) * u;
+			break;
+		}
+		case AnimationInterpolation::CubicSpline: {
+			auto u2 = u * u;
+			auto u3 = u2 * u;
+			for (std::size_t c = 0; c < count; ++c) {
+				auto vk = v0[componentCount + c];       // Property value of keyframe k.
+				auto bk = v0[2 * componentCount + c];   // Out-tangent of keyframe k.
+				auto ak1 = v1[c];                       // In-tangent of keyframe k + 1.
+				auto vk1 = v1[componentCount + c];      // Property value of keyframe k + 1.
+				out[c] = (2 * u3 - 3 * u2 + 1) * vk + dt * (u3 - 2 * u2 + u) * bk
+						+ (-2 * u3 + 3 * u2) * vk1 + dt * (u3 - u2) * ak1;
+			}
+			break;
+		}
+	}
+}
+
+/**
+ * Samples a cached rotation sampler at the given time. Linear samplers are interpolated with
+ * spherical linear interpolation along the shortest path as the spec recommends, and the
+ * result is always normalized.
+ */
+inline void sampleAnimationRotation(const AnimationSamplerCache& sampler, float time, float* out) {
+	if (sampler.interpolation == AnimationInterpolation::Linear && !sampler.times.empty()
+			&& time > sampler.times.front() && time < sampler.times.back()) {
+		auto next = static_cast<std::size_t>(std::upper_bound(sampler.times.begin(), sampler.times.end(), time) - sampler.times.begin());
+		auto prev = next - 1;
+		auto dt = sampler.times[next] - sampler.times[prev];
+		auto u = dt > 0.0f ? (time - sampler.times[prev]) / dt : 0.0f;
+
+		const auto* q0 = sampler.values.data() + prev * sampler.valuesPerKeyframe;
+		const auto* q1 = sampler.values.data() + next * sampler.valuesPerKeyframe;
+		auto dot = q0[0] * q1[0] + q0[1] * q1[1] + q0[2] * q1[2] + q0[3] * q1[3];
+		auto sign = 1.0f;
+		if (dot < 0.0f) {
+			// Negating one endpoint interpolates along the shorter of the two arcs.
+			dot = -dot;
+			sign = -1.0f;
+		}
+
+		float w0, w1;
+		if (dot > 0.9995f) {
+			// The quaternions are nearly parallel, where slerp becomes numerically unstable
+			// and a normalized lerp is exact enough.
+			w0 = 1.0f - u;
+			w1 = u;
+		} else {
+			auto theta = std::acos(dot);
+			auto sinTheta = std::sin(theta);
+			w0 = std::sin((1.0f - u) * theta) / sinTheta;
+			w1 = std::sin(u * theta) / sinTheta;
+		}
+
+		for (std::size_t c = 0; c < 4; ++c)
+			out[c] = w0 * q0[c] + sign * w1 * q1[c];
+	} else {
+		sampleAnimationSampler(sampler, time, out, 4);
+	}
+
+	auto length = std::sqrt(out[0] * out[0] + out[1] * out[1] + out[2] * out[2] + out[3] * out[3]);
+	if (length > 0.0f) {
+		for (std::size_t c = 0; c < 4; ++c)
+			out[c] /= length;
+	}
+}
+
+/**
+ * Samples every channel of the given animation at the given time in one pass over the packed
+ * keyframe data, and writes the results into the targeted node transforms and morph weights.
+ * Channels that target a node holding a transformation matrix are skipped, as the spec forbids
+ * animating such nodes; use Options::DecomposeNodeMatrices to avoid that situation.
+ */
+inline void evaluateAnimation(Asset& asset, std::size_t animationIndex, const AnimationCache& cache, float time) {
+	assert(animationIndex < asset.animations.size());
+	const auto& animation = asset.animations[animationIndex];
+	assert(cache.samplers.size() == animation.samplers.size());
+
+	for (const auto& channel : animation.channels) {
+		if (channel.samplerIndex >= cache.samplers.size() || channel.nodeIndex >= asset.nodes.size())
+			continue;
+		const auto& sampler = cache.samplers[channel.samplerIndex];
+		auto& node = asset.nodes[channel.nodeIndex];
+
+		if (channel.path == AnimationPath::Weights) {
+			if (!node.weights.empty())
+				sampleAnimationSampler(sampler, time, node.weights.data(), node.weights.size());
+			continue;
+		}
+
+		auto* trs = std::get_if<Node::TRS>(&node.transform);
+		if (trs == nullptr)
+			continue;
+
+		switch (channel.path) {
+			case AnimationPath::Translation:
+				sampleAnimationSampler(sampler, time, trs->translation.data(), 3);
+				break;
+			case AnimationPath::Rotation:
+				sampleAnimationRotation(sampler, time, trs->rotation.data());
+				break;
+			case AnimationPath::Scale:
+				sampleAnimationSampler(sampler, time, trs->scale.data(), 3);
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/**
+ * One entry of a flattened scene hierarchy, pairing the original node index with its parent's
+ * position in the flattened array and the precomputed global transform.
+ */
+struct FlattenedNode {
+	/** Marks nodes without a parent, i.e. the root nodes of the scene. */
+	static constexpr std::size_t noParent = std::numeric_limits<std::size_t>::max();
+
+	/** Index of the node within Asset::nodes. */
+	std::size_t nodeIndex = 0;
+
+	/** Index of the parent within FlattenedScene::nodes, or noParent for root nodes. */
+	std::size_t parentIndex = noParent;
+
+	/** The node's global transform as a column-major 4x4 matrix. */
+	Node::TransformMatrix globalTransform;
+};
+
+/**
+ * A contiguous, topologically ordered copy of one scene's node hierarchy. Every node appears
+ * after its parent, so a single linear pass visits parents before children, without chasing
+ * Node::children indices. Rebuild it with flattenScene whenever node transforms change.
+ */
+struct FlattenedScene {
+	std::vector<FlattenedNode> nodes;
+};
+
+/**
+ * Returns the node's local transform as a column-major 4x4 matrix, composing the TRS components
+ * in the T * R * S order the glTF spec mandates when the node doesn't store a matrix directly.
+ */
+inline Node::TransformMatrix getLocalTransformMatrix(const Node& node) {
+	if (const auto* matrix = std::get_if<Node::TransformMatrix>(&node.transform); matrix != nullptr) {
+		return *matrix;
+	}
+
+	const auto& trs = std::get<Node::TRS>(node.transform);
+	auto x = trs.rotation[0], y = trs.rotation[1], z = trs.rotation[2], w = trs.rotation[3];
+	return Node::TransformMatrix {{
+		(1 - 2 * (y * y + z * z)) * trs.scale[0],
+		(2 * (x * y + w * z)) * trs.scale[0],
+		(2 * (x * z - w * y)) * trs.scale[0],
+		0.0f,
+
+		(2 * (x * y - w * z)) * trs.scale[1],
+		(1 - 2 * (x * x + z * z)) * trs.scale[1],
+		(2 * (y * z + w * x)) * trs.scale[1],
+		0.0f,
+
+		(2 * (x * z + w * y)) * trs.scale[2],
+		(2 * (y * z - w * x)) * trs.scale[2],
+		(1 - 2 * (x * x + y * y)) * trs.scale[2],
+		0.0f,
+
+		trs.translation[0],
+		trs.translation[1],
+		trs.translation[2],
+		1.0f,
+	}};
+}
+
+/**
+ * Multiplies two column-major 4x4 transform matrices, returning a * b.
+ */
+inline Node::TransformMatrix multiplyTransformMatrices(const Node::TransformMatrix& a, const Node::TransformMatrix& b) {
+	Node::TransformMatrix result {};
+	for (std::size_t col = 0; col < 4; ++col) {
+		for (std::size_t row = 0; row < 4; ++row) {
+			for (std::size_t k = 0; k < 4; ++k) {
+				result[col * 4 + row] += a[k * 4 + row] * b[col * 4 + k];
+			}
+		}
+	}
+	return result;
+}
+
+/**
+ * Flattens the node hierarchy of the given scene into a contiguous array in breadth-first order,
+ * computing the global transform of every node along the way. Nodes with indices outside of
+ * Asset::nodes are skipped.
+ */
+inline FlattenedScene flattenScene(const Asset& asset, std::size_t sceneIndex) {
+	assert(sceneIndex < asset.scenes.size());
+	const auto& scene = asset.scenes[sceneIndex];
+
+	FlattenedScene flattened;
+	flattened.nodes.reserve(asset.nodes.size());
+
+	for (auto rootIndex : scene.nodeIndices) {
+		if (rootIndex >= asset.nodes.size())
+			continue;
+		flattened.nodes.push_back({ rootIndex, FlattenedNode::noParent, getLocalTransformMatrix(asset.nodes[rootIndex]) });
+	}
+
+	// The array itself doubles as the traversal queue, as nodes are visited in exactly the
+	// order they were appended in.
+	for (std::size_t i = 0; i < flattened.nodes.size(); ++i) {
+		const auto& node = asset.nodes[flattened.nodes[i].nodeIndex];
+		// Copy, as appending to the array invalidates references into it.
+		const auto parentTransform = flattened.nodes[i].globalTransform;
+		for (auto childIndex : node.children) {
+			if (childIndex >= asset.nodes.size())
+				continue;
+			flattened.nodes.push_back({ childIndex, i,
+					multiplyTransformMatrices(parentTransform, getLocalTransformMatrix(asset.nodes[childIndex])) });
 		}
 	}
+	return flattened;
 }
 
 } // namespace fastgltf
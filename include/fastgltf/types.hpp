@@ -31,8 +31,10 @@
 #include <cstring>
 #include <cstdint>
 #include <filesystem>
+#include <memory>
 #include <memory_resource>
 #include <optional>
+#include <unordered_map>
 #include <utility>
 #include <variant>
 #include <vector>
@@ -327,6 +329,28 @@ namespace fastgltf {
 
         return AccessorType::Invalid;
     }
+
+    // The string representations of the accessor types, in the same order as the accessorTypes array.
+    static constexpr std::array<std::string_view, 7> accessorTypeNames = {
+        "SCALAR",
+        "VEC2",
+        "VEC3",
+        "VEC4",
+        "MAT2",
+        "MAT3",
+        "MAT4",
+    };
+
+    /**
+     * Gets the string representation of the AccessorType as found in glTF files, the inverse of
+     * fastgltf::getAccessorType. Returns an empty string for AccessorType::Invalid.
+     */
+    constexpr std::string_view getAccessorTypeName(AccessorType type) noexcept {
+        std::size_t idx = to_underlying(type) & 0xFF;
+        if (idx == 0 || idx > accessorTypeNames.size())
+            return "";
+        return accessorTypeNames[idx - 1];
+    }
 #pragma endregion
 
 #pragma region Containers
@@ -390,7 +414,7 @@ namespace fastgltf {
             copy(other.begin(), other.size(), begin());
         }
 
-        SmallVector(SmallVector&& other) noexcept : _data(reinterpret_cast<T*>(storage.data())) {
+        SmallVector(SmallVector&& other) noexcept : allocator(std::move(other.allocator)), _data(reinterpret_cast<T*>(storage.data())) {
             if (other.isUsingStack()) {
                 if (!other.empty()) {
                     resize(other.size());
@@ -423,6 +447,22 @@ namespace fastgltf {
 
         SmallVector& operator=(SmallVector&& other) noexcept {
             if (std::addressof(other) != this) {
+                // Destroy the current contents, returning any heap allocation through the
+                // allocator that created it.
+                std::destroy(begin(), end());
+                if (!isUsingStack() && _data) {
+                    allocator.deallocate(_data, _capacity);
+                }
+                _data = reinterpret_cast<T*>(storage.data());
+                _size = 0;
+                _capacity = N;
+
+                // The heap data moves over together with the allocator it was created by, so
+                // that it also gets deallocated through that same allocator later. Allocators
+                // like std::pmr::polymorphic_allocator are not assignable, hence the in-place
+                // reconstruction.
+                allocator.~Allocator();
+                new (&allocator) Allocator(std::move(other.allocator));
                 if (other.isUsingStack()) {
                     if (!other.empty()) {
                         resize(other.size());
@@ -490,27 +530,35 @@ namespace fastgltf {
                 return;
             }
 
-            // We use geometric growth, similarly to std::vector.
-            newCapacity = std::size_t(1) << (std::numeric_limits<decltype(newCapacity)>::digits - clz(newCapacity));
+            // We use geometric growth, similarly to std::vector. The requested capacity gets
+            // rounded up to the next power of two, but exact powers of two are kept as-is so
+            // that explicit reserves from known element counts don't allocate twice the memory.
+            newCapacity = std::size_t(1) << (std::numeric_limits<decltype(newCapacity)>::digits - clz(newCapacity - 1));
 
 			T* alloc = allocator.allocate(newCapacity);
 
-			// Copy/Move the old data into the new memory
-			for (std::size_t i = 0; i < size(); ++i) {
-				auto& x = (*this)[i];
-				if constexpr (std::is_nothrow_move_constructible_v<T>) {
-					new(alloc + i) T(std::move(x));
-				} else if constexpr (std::is_copy_constructible_v<T>) {
-					new(alloc + i) T(x);
-				} else {
-					new(alloc + i) T(std::move(x));
+			if constexpr (std::is_trivially_copyable_v<T>) {
+				// Trivially copyable types can be relocated with a single memcpy, and don't
+				// need their old objects destroyed.
+				std::memcpy(alloc, _data, size() * sizeof(T));
+			} else {
+				// Copy/Move the old data into the new memory
+				for (std::size_t i = 0; i < size(); ++i) {
+					auto& x = (*this)[i];
+					if constexpr (std::is_nothrow_move_constructible_v<T>) {
+						new(alloc + i) T(std::move(x));
+					} else if constexpr (std::is_copy_constructible_v<T>) {
+						new(alloc + i) T(x);
+					} else {
+						new(alloc + i) T(std::move(x));
+					}
 				}
-			}
 
-			// Destroy all objects in the old allocation
-			std::destroy(begin(), end());
+				// Destroy all objects in the old allocation
+				std::destroy(begin(), end());
+			}
 
-            if (!isUsingStack() && _data && size() != 0) {
+            if (!isUsingStack() && _data) {
 				allocator.deallocate(_data, _capacity);
             }
 
@@ -531,8 +579,13 @@ namespace fastgltf {
                 // Reserve enough capacity and copy the new value over.
                 auto oldSize = _size;
                 reserve(newSize);
-                for (auto it = begin() + oldSize; it != begin() + newSize; ++it) {
-                    new (it) T();
+                if constexpr (std::is_trivially_copyable_v<T> && std::is_trivially_default_constructible_v<T>) {
+                    // Value-initialisation zeroes trivial types, which memset does in one go.
+                    std::memset(begin() + oldSize, 0, (newSize - oldSize) * sizeof(T));
+                } else {
+                    for (auto it = begin() + oldSize; it != begin() + newSize; ++it) {
+                        new (it) T();
+                    }
                 }
             }
 
@@ -582,8 +635,12 @@ namespace fastgltf {
 			} else {
 				// We have to use heap allocated memory.
 				auto* alloc = allocator.allocate(size());
-				for (std::size_t i = 0; i < size(); ++i) {
-					new(alloc + i) T((*this)[i]);
+				if constexpr (std::is_trivially_copyable_v<T>) {
+					std::memcpy(alloc, _data, size() * sizeof(T));
+				} else {
+					for (std::size_t i = 0; i < size(); ++i) {
+						new(alloc + i) T((*this)[i]);
+					}
 				}
 
 				if (_data && !isUsingStack()) {
@@ -1025,6 +1082,17 @@ namespace fastgltf {
         std::pmr::string name;
     };
 
+    /**
+     * Data from KHR_draco_mesh_compression on a mesh primitive.
+     */
+    struct DracoCompressedPrimitive {
+        std::size_t bufferViewIndex;
+
+        // Pairs each attribute name with the unique attribute id inside the Draco geometry,
+        // mirroring the layout of Primitive::attributes.
+        pmr::SmallVector<std::pair<std::pmr::string, std::size_t>, 4> attributes;
+    };
+
     struct Primitive {
 		using attribute_type = std::pair<std::pmr::string, std::size_t>;
 
@@ -1038,6 +1106,11 @@ namespace fastgltf {
         std::optional<std::size_t> indicesAccessor;
         std::optional<std::size_t> materialIndex;
 
+        /**
+         * Data from KHR_draco_mesh_compression, and nullptr if the extension was not enabled or used.
+         */
+        std::unique_ptr<DracoCompressedPrimitive> dracoCompression;
+
 		[[nodiscard]] auto findAttribute(std::string_view name) {
 			for (decltype(attributes)::iterator it = attributes.begin(); it != attributes.end(); ++it) {
 				if (it->first == name)
@@ -1372,8 +1445,33 @@ namespace fastgltf {
     };
 
 	class ChunkMemoryResource;
+	class MappedGltfDataBuffer;
 	class Parser;
 
+    /**
+     * Lookup tables from object name to the index within the correspondingly named Asset vector,
+     * so that repeated name searches don't have to scan the vectors linearly. The maps keep
+     * string views into the object names, meaning they are only valid for as long as the indexed
+     * objects are left unmodified.
+     */
+    struct NameIndex {
+        /**
+         * Hashes names with the same crc32c that the parser uses for JSON keys.
+         */
+        struct Crc32cHash {
+            [[nodiscard]] std::size_t operator()(std::string_view str) const noexcept {
+                return crc32c(str);
+            }
+        };
+
+        using Map = std::unordered_map<std::string_view, std::size_t, Crc32cHash>;
+
+        Map nodes;
+        Map meshes;
+        Map materials;
+        Map animations;
+    };
+
 	class Asset {
 		friend class Parser;
 
@@ -1381,6 +1479,12 @@ namespace fastgltf {
 		// alive until the end.
 		std::shared_ptr<ChunkMemoryResource> memoryResource;
 
+		std::unique_ptr<NameIndex> nameIndex;
+
+		// Owns the file mappings that sources::ByteView spans point into when external buffers
+		// were loaded with Options::MapExternalBuffers.
+		std::vector<std::shared_ptr<MappedGltfDataBuffer>> bufferMappings;
+
 	public:
         /**
          * This will only ever have no value if #Options::DontRequireValidAssetMember was specified.
@@ -1405,10 +1509,98 @@ namespace fastgltf {
         // Keeps tracked of categories that were actually parsed.
         Category availableCategories = Category::None;
 
+        /**
+         * (Re)builds the name lookup maps over nodes, meshes, materials, and animations. The
+         * index is not kept up to date automatically, so this has to be called again after
+         * adding, removing, or renaming any of these objects. Objects with empty names are not
+         * indexed, and when multiple objects share a name the smallest index wins.
+         */
+        void buildNameIndex() {
+            if (nameIndex == nullptr)
+                nameIndex = std::make_unique<NameIndex>();
+            auto fill = [](NameIndex::Map& map, const auto& objects) {
+                map.clear();
+                map.reserve(objects.size());
+                for (std::size_t i = 0; i < objects.size(); ++i) {
+                    if (!objects[i].name.empty())
+                        map.emplace(std::string_view(objects[i].name), i);
+                }
+            };
+            fill(nameIndex->nodes, nodes);
+            fill(nameIndex->meshes, meshes);
+            fill(nameIndex->materials, materials);
+            fill(nameIndex->animations, animations);
+        }
+
+        /**
+         * Returns the index of the node with the given name, building the name index on first
+         * use. See buildNameIndex() for the exact lookup semantics.
+         */
+        [[nodiscard]] std::optional<std::size_t> findNodeByName(std::string_view nodeName) {
+            if (nameIndex == nullptr)
+                buildNameIndex();
+            auto it = nameIndex->nodes.find(nodeName);
+            if (it == nameIndex->nodes.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        /**
+         * Returns the index of the mesh with the given name, building the name index on first
+         * use. See buildNameIndex() for the exact lookup semantics.
+         */
+        [[nodiscard]] std::optional<std::size_t> findMeshByName(std::string_view meshName) {
+            if (nameIndex == nullptr)
+                buildNameIndex();
+            auto it = nameIndex->meshes.find(meshName);
+            if (it == nameIndex->meshes.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        /**
+         * Returns the index of the material with the given name, building the name index on
+         * first use. See buildNameIndex() for the exact lookup semantics.
+         */
+        [[nodiscard]] std::optional<std::size_t> findMaterialByName(std::string_view materialName) {
+            if (nameIndex == nullptr)
+                buildNameIndex();
+            auto it = nameIndex->materials.find(materialName);
+            if (it == nameIndex->materials.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        /**
+         * Returns the index of the animation with the given name, building the name index on
+         * first use. See buildNameIndex() for the exact lookup semantics.
+         */
+        [[nodiscard]] std::optional<std::size_t> findAnimationByName(std::string_view animationName) {
+            if (nameIndex == nullptr)
+                buildNameIndex();
+            auto it = nameIndex->animations.find(animationName);
+            if (it == nameIndex->animations.end())
+                return std::nullopt;
+            return it->second;
+        }
+
+        /**
+         * Shrinks the resident memory of the asset by moving all arena-backed strings and
+         * vectors into a single freshly allocated block sized from the amount of memory the
+         * parse actually used, and then releasing the parse-time arena. The parse-time arena
+         * over-allocates in chunks and additionally holds intermediate allocations that are no
+         * longer referenced, so for assets that are kept alive for a long time this can free a
+         * significant amount of memory. All pointers, views, and iterators into the asset are
+         * invalidated, including any name index previously built with buildNameIndex().
+         */
+        void compact();
+
         explicit Asset() = default;
         explicit Asset(const Asset& other) = delete;
         Asset(Asset&& other) noexcept :
 				memoryResource(std::move(other.memoryResource)),
+				nameIndex(std::move(other.nameIndex)),
+				bufferMappings(std::move(other.bufferMappings)),
 				assetInfo(std::move(other.assetInfo)),
 				defaultScene(other.defaultScene),
 				accessors(std::move(other.accessors)),
@@ -1430,6 +1622,8 @@ namespace fastgltf {
 		Asset& operator=(const Asset& other) = delete;
 		Asset& operator=(Asset&& other) noexcept {
 			memoryResource = std::move(other.memoryResource);
+			nameIndex = std::move(other.nameIndex);
+			bufferMappings = std::move(other.bufferMappings);
 			assetInfo = std::move(other.assetInfo);
 			defaultScene = other.defaultScene;
 			accessors = std::move(other.accessors);
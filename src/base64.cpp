@@ -28,9 +28,11 @@
 #error "fastgltf requires C++17"
 #endif
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <functional>
+#include <thread>
 
 #if defined(FASTGLTF_IS_X86)
 #include <immintrin.h>
@@ -71,7 +73,11 @@ namespace fastgltf::base64 {
             // they load multiple at once.
             const auto& impls = simdjson::get_available_implementations();
 #if defined(FASTGLTF_IS_X86)
-            if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
+            // The icelake implementation requires the AVX-512VBMI instructions our kernel uses.
+            if (const auto* avx512 = impls["icelake"]; avx512 != nullptr && avx512->supported_by_runtime_system()) {
+                func = avx512_decode;
+                inplace = avx512_decode_inplace;
+            } else if (const auto* avx2 = impls["haswell"]; avx2 != nullptr && avx2->supported_by_runtime_system()) {
                 func = avx2_decode;
                 inplace = avx2_decode_inplace;
             } else if (const auto* sse4 = impls["westmere"]; sse4 != nullptr && sse4->supported_by_runtime_system()) {
@@ -102,11 +108,88 @@ namespace fastgltf::base64 {
     };
 } // namespace fastgltf::base64
 
+// clang-format off
+// ASCII value -> base64 value LUT
+static constexpr std::array<std::uint8_t, 128> base64lut = {
+    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
+    0,0,0,0,0,0,0,
+    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,
+    0,0,0,0,0,0,
+    26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,
+    0,0,0,0,0,
+};
+// clang-format on
+
 #if defined(FASTGLTF_IS_X86)
 // The AVX and SSE decoding functions are based on http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html.
 // It covers various methods of en-/decoding base64 using SSE and AVX and also shows their
 // performance metrics.
 // TODO: Mark these functions with msvc::forceinline which is available from C++20
+[[gnu::target("avx512f,avx512bw,avx512vbmi")]] void fg::base64::avx512_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding) {
+    constexpr auto dataSetSize = 64;
+    constexpr auto dataOutputSize = 48;
+
+    if (encoded.size() < dataSetSize) {
+        fallback_decode_inplace(encoded, output, padding);
+        return;
+    }
+
+    // We align the size to the highest size divisible by 48. By doing this, we don't need to
+    // allocate any new memory to hold the encoded data and let the fallback decoder decode the
+    // remaining data.
+    const auto encodedSize = encoded.size();
+    const auto outputSize = getOutputSize(encodedSize, padding);
+    const auto alignedSize = outputSize - (outputSize % dataOutputSize);
+    auto* out = output;
+
+    // With AVX-512VBMI the ASCII -> 6-bit value translation is a single vpermi2b through the
+    // decode LUT, and the final gather of the decoded bytes is a single vpermb, which is what
+    // makes this kernel quite a bit faster than the AVX2 shift arithmetic above.
+    const auto lutLo = _mm512_loadu_si512(base64lut.data());
+    const auto lutHi = _mm512_loadu_si512(base64lut.data() + 64);
+
+    // Gathers the 3 decoded bytes of all 16 32-bit integers into the lower 48 bytes.
+    static constexpr std::array<std::uint8_t, 64> shuffleData = {{
+        2,   1,  0,  6,  5,  4, 10,  9,  8, 14, 13, 12,
+        18, 17, 16, 22, 21, 20, 26, 25, 24, 30, 29, 28,
+        34, 33, 32, 38, 37, 36, 42, 41, 40, 46, 45, 44,
+        50, 49, 48, 54, 53, 52, 58, 57, 56, 62, 61, 60,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    }};
+    const auto shuffle = _mm512_loadu_si512(shuffleData.data());
+    constexpr __mmask64 storeMask = (1ULL << dataOutputSize) - 1;
+
+    std::size_t pos = 0;
+    while ((pos + dataSetSize) < alignedSize) {
+        auto in = _mm512_loadu_si512(&encoded[pos]);
+        auto values = _mm512_permutex2var_epi8(lutLo, in, lutHi);
+        const auto merge = _mm512_maddubs_epi16(values, _mm512_set1_epi32(0x01400140));
+        const auto merged = _mm512_madd_epi16(merge, _mm512_set1_epi32(0x00011000));
+        const auto shuffled = _mm512_permutexvar_epi8(shuffle, merged);
+
+        // A masked store never writes past the 48 decoded bytes.
+        _mm512_mask_storeu_epi8(out, storeMask, shuffled);
+
+        out += dataOutputSize;
+        pos += dataSetSize;
+    }
+
+    // Decode the last chunk traditionally
+    fallback_decode_inplace(encoded.substr(pos, encodedSize), out, padding);
+}
+
+[[gnu::target("avx512f,avx512bw,avx512vbmi")]] std::vector<std::uint8_t> fg::base64::avx512_decode(std::string_view encoded) {
+    const auto encodedSize = encoded.size();
+    const auto padding = getPadding(encoded);
+
+    std::vector<std::uint8_t> ret(getOutputSize(encodedSize, padding));
+    avx512_decode_inplace(encoded, ret.data(), padding);
+
+    return ret;
+}
+
 [[gnu::target("avx2"), gnu::always_inline]] FORCEINLINE auto avx2_lookup_pshufb_bitmask(const __m256i input) {
     const auto higher_nibble = _mm256_and_si256(_mm256_srli_epi32(input, 4), _mm256_set1_epi8(0x0f));
 
@@ -361,19 +444,6 @@ std::vector<std::uint8_t> fg::base64::neon_decode(std::string_view encoded) {
 }
 #endif
 
-// clang-format off
-// ASCII value -> base64 value LUT
-static constexpr std::array<std::uint8_t, 128> base64lut = {
-    0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,63,
-    52, 53, 54, 55, 56, 57, 58, 59, 60, 61,
-    0,0,0,0,0,0,0,
-    0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,16,17,18,19,20,21,22,23,24,25,
-    0,0,0,0,0,0,
-    26,27,28,29,30,31,32,33,34,35,36,37,38,39,40,41,42,43,44,45,46,47,48,49,50,51,
-    0,0,0,0,0,
-};
-// clang-format on
-
 void fg::base64::fallback_decode_inplace(std::string_view encoded, std::uint8_t* output, std::size_t padding) {
     std::array<std::uint8_t, 4> sixBitChars = {};
     std::array<std::uint8_t, 3> eightBitChars = {};
@@ -424,6 +494,40 @@ std::vector<std::uint8_t> fg::base64::decode(std::string_view encoded) {
     return DecodeFunctionGetter::get()->func(encoded);
 }
 
+void fg::base64::decode_inplace_parallel(std::string_view encoded, std::uint8_t* output, std::size_t padding, unsigned int threadCount) {
+    assert(encoded.size() % 4 == 0);
+
+    // Below this chunk size the thread spawns cost more than the decoding itself.
+    constexpr std::size_t minChunkSize = 64 * 1024;
+    if (threadCount <= 1 || encoded.size() < minChunkSize * 2) {
+        decode_inplace(encoded, output, padding);
+        return;
+    }
+
+    // Round the chunk size up to a multiple of 4 chars, so that every chunk decodes a whole
+    // number of 4-char blocks. The SIMD kernels never store past the decoded size of their own
+    // input, so the workers can write into the shared output simultaneously.
+    const auto chunkCount = std::min<std::size_t>(threadCount, encoded.size() / minChunkSize);
+    const auto chunkSize = (((encoded.size() / chunkCount) + 3) / 4) * 4;
+
+    std::vector<std::thread> workers;
+    workers.reserve(chunkCount - 1);
+    std::size_t pos = 0;
+    while (pos + chunkSize < encoded.size()) {
+        workers.emplace_back([encoded, output, pos, chunkSize]() {
+            decode_inplace(encoded.substr(pos, chunkSize), output + (pos / 4) * 3, 0);
+        });
+        pos += chunkSize;
+    }
+
+    // The calling thread decodes the last chunk, which is the only one affected by the padding.
+    decode_inplace(encoded.substr(pos), output + (pos / 4) * 3, padding);
+
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
@@ -0,0 +1,839 @@
+/*
+ * Copyright (C) 2022 - 2023 spnda
+ * This file is part of fastgltf <https://github.com/spnda/fastgltf>.
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#if !defined(__cplusplus) || (!defined(_MSVC_LANG) && __cplusplus < 201703L) || (defined(_MSVC_LANG) && _MSVC_LANG < 201703L)
+#error "fastgltf requires C++17"
+#endif
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+
+#include <fastgltf/export.hpp>
+#include <fastgltf/types.hpp>
+#include <fastgltf/util.hpp>
+
+namespace fg = fastgltf;
+namespace fs = std::filesystem;
+
+namespace fastgltf {
+    // These mirror the constants the parser uses for reading GLB containers.
+    constexpr std::uint32_t exportGltfHeaderMagic = 0x46546C67; // ASCII for "glTF".
+    constexpr std::uint32_t exportGltfJsonChunkMagic = 0x4E4F534A;
+    constexpr std::uint32_t exportGltfDataChunkMagic = 0x004E4942;
+
+    constexpr std::size_t alignToChunk(std::size_t size) noexcept {
+        return (size + 3) & ~std::size_t(3);
+    }
+
+    void appendLE32(std::uint8_t* dst, std::uint32_t value) noexcept {
+        // The parser reads GLB headers with a plain memcpy, so we write them the same way.
+        std::memcpy(dst, &value, sizeof value);
+    }
+
+    void writeLE32(std::ofstream& file, std::uint32_t value) {
+        file.write(reinterpret_cast<const char*>(&value), sizeof value);
+    }
+
+    /**
+     * Returns the raw bytes behind a data source when it holds them in memory, or an empty span
+     * for every source that references data elsewhere.
+     */
+    span<const std::byte> getSourceByteSpan(const DataSource& data) noexcept {
+        if (const auto* vector = std::get_if<sources::Vector>(&data); vector != nullptr)
+            return span<const std::byte>(reinterpret_cast<const std::byte*>(vector->bytes.data()), vector->bytes.size());
+        if (const auto* view = std::get_if<sources::ByteView>(&data); view != nullptr)
+            return view->bytes;
+        return {};
+    }
+
+#pragma region JSON emission helpers
+    // Appends a comma unless we're at the start of an object or array. This lets every field
+    // writer stay oblivious of whether any optional field before it was present.
+    void appendSeparator(std::string& json) {
+        if (!json.empty() && json.back() != '{' && json.back() != '[')
+            json += ',';
+    }
+
+    void appendEscapedString(std::string& json, std::string_view value) {
+        json += '"';
+        for (auto c : value) {
+            switch (c) {
+                case '"': json += "\\\""; break;
+                case '\\': json += "\\\\"; break;
+                case '\b': json += "\\b"; break;
+                case '\f': json += "\\f"; break;
+                case '\n': json += "\\n"; break;
+                case '\r': json += "\\r"; break;
+                case '\t': json += "\\t"; break;
+                default: {
+                    if (static_cast<unsigned char>(c) < 0x20) {
+                        char buf[8];
+                        auto len = std::snprintf(buf, sizeof buf, "\\u%04X", static_cast<unsigned char>(c));
+                        json.append(buf, static_cast<std::size_t>(len));
+                    } else {
+                        json += c;
+                    }
+                }
+            }
+        }
+        json += '"';
+    }
+
+    void appendKey(std::string& json, std::string_view key) {
+        appendSeparator(json);
+        json += '"';
+        json += key;
+        json += "\":";
+    }
+
+    void appendUInt(std::string& json, std::size_t value) {
+        char buf[24];
+        auto len = std::snprintf(buf, sizeof buf, "%llu", static_cast<unsigned long long>(value));
+        json.append(buf, static_cast<std::size_t>(len));
+    }
+
+    void appendInt(std::string& json, std::int64_t value) {
+        char buf[24];
+        auto len = std::snprintf(buf, sizeof buf, "%lld", static_cast<long long>(value));
+        json.append(buf, static_cast<std::size_t>(len));
+    }
+
+    void appendFloat(std::string& json, float value) {
+        // 9 significant digits round-trip any binary32 value.
+        char buf[32];
+        auto len = std::snprintf(buf, sizeof buf, "%.9g", static_cast<double>(value));
+        json.append(buf, static_cast<std::size_t>(len));
+    }
+
+    void appendDouble(std::string& json, double value) {
+        // 17 significant digits round-trip any binary64 value.
+        char buf[32];
+        auto len = std::snprintf(buf, sizeof buf, "%.17g", value);
+        json.append(buf, static_cast<std::size_t>(len));
+    }
+
+    void appendUIntField(std::string& json, std::string_view key, std::size_t value) {
+        appendKey(json, key);
+        appendUInt(json, value);
+    }
+
+    void appendFloatField(std::string& json, std::string_view key, float value) {
+        appendKey(json, key);
+        appendFloat(json, value);
+    }
+
+    void appendStringField(std::string& json, std::string_view key, std::string_view value) {
+        appendKey(json, key);
+        appendEscapedString(json, value);
+    }
+
+    void appendNameField(std::string& json, const std::pmr::string& name) {
+        if (!name.empty())
+            appendStringField(json, "name", std::string_view { name.data(), name.size() });
+    }
+
+    void appendFloatArrayField(std::string& json, std::string_view key, const float* values, std::size_t count) {
+        appendKey(json, key);
+        json += '[';
+        for (std::size_t i = 0; i < count; ++i) {
+            if (i != 0)
+                json += ',';
+            appendFloat(json, values[i]);
+        }
+        json += ']';
+    }
+
+    template <typename Container>
+    void appendIndexArrayField(std::string& json, std::string_view key, const Container& indices) {
+        appendKey(json, key);
+        json += '[';
+        for (std::size_t i = 0; i < indices.size(); ++i) {
+            if (i != 0)
+                json += ',';
+            appendUInt(json, indices[i]);
+        }
+        json += ']';
+    }
+
+    std::string_view getMimeTypeString(MimeType mimeType) noexcept {
+        switch (mimeType) {
+            case MimeType::JPEG: return "image/jpeg";
+            case MimeType::PNG: return "image/png";
+            case MimeType::KTX2: return "image/ktx2";
+            case MimeType::DDS: return "image/vnd-ms.dds";
+            case MimeType::GltfBuffer: return "application/gltf-buffer";
+            case MimeType::OctetStream: return "application/octet-stream";
+            default: return "";
+        }
+    }
+#pragma endregion
+
+#pragma region Category writers
+    Error appendBuffers(std::string& json, const Asset& asset, bool binaryBuffer) {
+        appendKey(json, "buffers");
+        json += '[';
+        for (std::size_t i = 0; i < asset.buffers.size(); ++i) {
+            const auto& buffer = asset.buffers[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            appendUIntField(json, "byteLength", buffer.byteLength);
+            if (i == 0 && binaryBuffer) {
+                // The first buffer becomes the BIN chunk and has no URI.
+                if (getSourceByteSpan(buffer.data).data() == nullptr)
+                    return Error::InvalidGltf;
+            } else if (const auto* uri = std::get_if<sources::URI>(&buffer.data); uri != nullptr) {
+                appendStringField(json, "uri", uri->uri.string());
+            } else {
+                // In-memory and custom buffer sources cannot be referenced from JSON.
+                return Error::InvalidGltf;
+            }
+            appendNameField(json, buffer.name);
+            json += '}';
+        }
+        json += ']';
+        return Error::None;
+    }
+
+    void appendBufferViews(std::string& json, const Asset& asset) {
+        appendKey(json, "bufferViews");
+        json += '[';
+        for (std::size_t i = 0; i < asset.bufferViews.size(); ++i) {
+            const auto& view = asset.bufferViews[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            appendUIntField(json, "buffer", view.bufferIndex);
+            if (view.byteOffset != 0)
+                appendUIntField(json, "byteOffset", view.byteOffset);
+            appendUIntField(json, "byteLength", view.byteLength);
+            if (view.byteStride.has_value())
+                appendUIntField(json, "byteStride", view.byteStride.value());
+            if (view.target.has_value())
+                appendUIntField(json, "target", to_underlying(view.target.value()));
+            appendNameField(json, view.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendAccessorBounds(std::string& json, std::string_view key, const decltype(Accessor::max)& bounds) {
+        if (const auto* doubles = std::get_if<std::pmr::vector<double>>(&bounds); doubles != nullptr) {
+            appendKey(json, key);
+            json += '[';
+            for (std::size_t i = 0; i < doubles->size(); ++i) {
+                if (i != 0)
+                    json += ',';
+                appendDouble(json, (*doubles)[i]);
+            }
+            json += ']';
+        } else if (const auto* ints = std::get_if<std::pmr::vector<std::int64_t>>(&bounds); ints != nullptr) {
+            appendKey(json, key);
+            json += '[';
+            for (std::size_t i = 0; i < ints->size(); ++i) {
+                if (i != 0)
+                    json += ',';
+                appendInt(json, (*ints)[i]);
+            }
+            json += ']';
+        }
+    }
+
+    void appendAccessors(std::string& json, const Asset& asset) {
+        appendKey(json, "accessors");
+        json += '[';
+        for (std::size_t i = 0; i < asset.accessors.size(); ++i) {
+            const auto& accessor = asset.accessors[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (accessor.bufferViewIndex.has_value())
+                appendUIntField(json, "bufferView", accessor.bufferViewIndex.value());
+            if (accessor.byteOffset != 0)
+                appendUIntField(json, "byteOffset", accessor.byteOffset);
+            appendUIntField(json, "componentType", getGLComponentType(accessor.componentType));
+            if (accessor.normalized) {
+                appendKey(json, "normalized");
+                json += "true";
+            }
+            appendUIntField(json, "count", accessor.count);
+            appendStringField(json, "type", getAccessorTypeName(accessor.type));
+            appendAccessorBounds(json, "max", accessor.max);
+            appendAccessorBounds(json, "min", accessor.min);
+            if (accessor.sparse.has_value()) {
+                const auto& sparse = accessor.sparse.value();
+                appendKey(json, "sparse");
+                json += '{';
+                appendUIntField(json, "count", sparse.count);
+                appendKey(json, "indices");
+                json += '{';
+                appendUIntField(json, "bufferView", sparse.indicesBufferView);
+                if (sparse.indicesByteOffset != 0)
+                    appendUIntField(json, "byteOffset", sparse.indicesByteOffset);
+                appendUIntField(json, "componentType", getGLComponentType(sparse.indexComponentType));
+                json += '}';
+                appendKey(json, "values");
+                json += '{';
+                appendUIntField(json, "bufferView", sparse.valuesBufferView);
+                if (sparse.valuesByteOffset != 0)
+                    appendUIntField(json, "byteOffset", sparse.valuesByteOffset);
+                json += '}';
+                json += '}';
+            }
+            appendNameField(json, accessor.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    Error appendImages(std::string& json, const Asset& asset) {
+        appendKey(json, "images");
+        json += '[';
+        for (std::size_t i = 0; i < asset.images.size(); ++i) {
+            const auto& image = asset.images[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (const auto* uri = std::get_if<sources::URI>(&image.data); uri != nullptr) {
+                appendStringField(json, "uri", uri->uri.string());
+                if (uri->mimeType != MimeType::None)
+                    appendStringField(json, "mimeType", getMimeTypeString(uri->mimeType));
+            } else if (const auto* view = std::get_if<sources::BufferView>(&image.data); view != nullptr) {
+                appendUIntField(json, "bufferView", view->bufferViewIndex);
+                appendStringField(json, "mimeType", getMimeTypeString(view->mimeType));
+            } else {
+                // Raw image bytes would need to be re-encoded into a data URI, which we don't do.
+                return Error::InvalidGltf;
+            }
+            appendNameField(json, image.name);
+            json += '}';
+        }
+        json += ']';
+        return Error::None;
+    }
+
+    void appendSamplers(std::string& json, const Asset& asset) {
+        appendKey(json, "samplers");
+        json += '[';
+        for (std::size_t i = 0; i < asset.samplers.size(); ++i) {
+            const auto& sampler = asset.samplers[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (sampler.magFilter.has_value())
+                appendUIntField(json, "magFilter", to_underlying(sampler.magFilter.value()));
+            if (sampler.minFilter.has_value())
+                appendUIntField(json, "minFilter", to_underlying(sampler.minFilter.value()));
+            if (sampler.wrapS != Wrap::Repeat)
+                appendUIntField(json, "wrapS", to_underlying(sampler.wrapS));
+            if (sampler.wrapT != Wrap::Repeat)
+                appendUIntField(json, "wrapT", to_underlying(sampler.wrapT));
+            appendNameField(json, sampler.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendTextures(std::string& json, const Asset& asset) {
+        appendKey(json, "textures");
+        json += '[';
+        for (std::size_t i = 0; i < asset.textures.size(); ++i) {
+            const auto& texture = asset.textures[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (texture.samplerIndex.has_value())
+                appendUIntField(json, "sampler", texture.samplerIndex.value());
+            if (texture.imageIndex.has_value()) {
+                appendUIntField(json, "source", texture.imageIndex.value());
+            } else if (texture.fallbackImageIndex.has_value()) {
+                appendUIntField(json, "source", texture.fallbackImageIndex.value());
+            }
+            appendNameField(json, texture.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendTextureInfo(std::string& json, std::string_view key, const TextureInfo& info, std::string_view scaleKey = {}) {
+        appendKey(json, key);
+        json += '{';
+        appendUIntField(json, "index", info.textureIndex);
+        if (info.texCoordIndex != 0)
+            appendUIntField(json, "texCoord", info.texCoordIndex);
+        if (!scaleKey.empty() && info.scale != 1.0f)
+            appendFloatField(json, scaleKey, info.scale);
+        json += '}';
+    }
+
+    void appendMaterials(std::string& json, const Asset& asset) {
+        appendKey(json, "materials");
+        json += '[';
+        for (std::size_t i = 0; i < asset.materials.size(); ++i) {
+            const auto& material = asset.materials[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+
+            const auto& pbr = material.pbrData;
+            constexpr std::array<float, 4> defaultBaseColor = {{ 1, 1, 1, 1 }};
+            auto hasPbr = pbr.baseColorFactor != defaultBaseColor || pbr.metallicFactor != 1.0f
+                || pbr.roughnessFactor != 1.0f || pbr.baseColorTexture.has_value()
+                || pbr.metallicRoughnessTexture.has_value();
+            if (hasPbr) {
+                appendKey(json, "pbrMetallicRoughness");
+                json += '{';
+                if (pbr.baseColorFactor != defaultBaseColor)
+                    appendFloatArrayField(json, "baseColorFactor", pbr.baseColorFactor.data(), 4);
+                if (pbr.metallicFactor != 1.0f)
+                    appendFloatField(json, "metallicFactor", pbr.metallicFactor);
+                if (pbr.roughnessFactor != 1.0f)
+                    appendFloatField(json, "roughnessFactor", pbr.roughnessFactor);
+                if (pbr.baseColorTexture.has_value())
+                    appendTextureInfo(json, "baseColorTexture", pbr.baseColorTexture.value());
+                if (pbr.metallicRoughnessTexture.has_value())
+                    appendTextureInfo(json, "metallicRoughnessTexture", pbr.metallicRoughnessTexture.value());
+                json += '}';
+            }
+
+            if (material.normalTexture.has_value())
+                appendTextureInfo(json, "normalTexture", material.normalTexture.value(), "scale");
+            if (material.occlusionTexture.has_value())
+                appendTextureInfo(json, "occlusionTexture", material.occlusionTexture.value(), "strength");
+            if (material.emissiveTexture.has_value())
+                appendTextureInfo(json, "emissiveTexture", material.emissiveTexture.value());
+            constexpr std::array<float, 3> defaultEmissive = {{ 0, 0, 0 }};
+            if (material.emissiveFactor != defaultEmissive)
+                appendFloatArrayField(json, "emissiveFactor", material.emissiveFactor.data(), 3);
+            if (material.alphaMode == AlphaMode::Mask) {
+                appendStringField(json, "alphaMode", "MASK");
+                if (material.alphaCutoff != 0.5f)
+                    appendFloatField(json, "alphaCutoff", material.alphaCutoff);
+            } else if (material.alphaMode == AlphaMode::Blend) {
+                appendStringField(json, "alphaMode", "BLEND");
+            }
+            if (material.doubleSided) {
+                appendKey(json, "doubleSided");
+                json += "true";
+            }
+            appendNameField(json, material.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    template <typename Attributes>
+    void appendAttributes(std::string& json, const Attributes& attributes) {
+        json += '{';
+        for (std::size_t i = 0; i < attributes.size(); ++i) {
+            if (i != 0)
+                json += ',';
+            const auto& attribute = attributes[i];
+            appendEscapedString(json, std::string_view { attribute.first.data(), attribute.first.size() });
+            json += ':';
+            appendUInt(json, attribute.second);
+        }
+        json += '}';
+    }
+
+    void appendMeshes(std::string& json, const Asset& asset) {
+        appendKey(json, "meshes");
+        json += '[';
+        for (std::size_t i = 0; i < asset.meshes.size(); ++i) {
+            const auto& mesh = asset.meshes[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            appendKey(json, "primitives");
+            json += '[';
+            for (std::size_t j = 0; j < mesh.primitives.size(); ++j) {
+                const auto& primitive = mesh.primitives[j];
+                if (j != 0)
+                    json += ',';
+                json += '{';
+                appendKey(json, "attributes");
+                appendAttributes(json, primitive.attributes);
+                if (primitive.indicesAccessor.has_value())
+                    appendUIntField(json, "indices", primitive.indicesAccessor.value());
+                if (primitive.materialIndex.has_value())
+                    appendUIntField(json, "material", primitive.materialIndex.value());
+                if (primitive.type != PrimitiveType::Triangles)
+                    appendUIntField(json, "mode", to_underlying(primitive.type));
+                if (!primitive.targets.empty()) {
+                    appendKey(json, "targets");
+                    json += '[';
+                    for (std::size_t k = 0; k < primitive.targets.size(); ++k) {
+                        if (k != 0)
+                            json += ',';
+                        appendAttributes(json, primitive.targets[k]);
+                    }
+                    json += ']';
+                }
+                json += '}';
+            }
+            json += ']';
+            if (!mesh.weights.empty())
+                appendFloatArrayField(json, "weights", mesh.weights.data(), mesh.weights.size());
+            appendNameField(json, mesh.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendNodes(std::string& json, const Asset& asset) {
+        appendKey(json, "nodes");
+        json += '[';
+        for (std::size_t i = 0; i < asset.nodes.size(); ++i) {
+            const auto& node = asset.nodes[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (node.cameraIndex.has_value())
+                appendUIntField(json, "camera", node.cameraIndex.value());
+            if (!node.children.empty())
+                appendIndexArrayField(json, "children", node.children);
+            if (node.skinIndex.has_value())
+                appendUIntField(json, "skin", node.skinIndex.value());
+            if (node.meshIndex.has_value())
+                appendUIntField(json, "mesh", node.meshIndex.value());
+            if (const auto* trs = std::get_if<Node::TRS>(&node.transform); trs != nullptr) {
+                constexpr std::array<float, 3> zero = {{ 0, 0, 0 }};
+                constexpr std::array<float, 4> identityRotation = {{ 0, 0, 0, 1 }};
+                constexpr std::array<float, 3> one = {{ 1, 1, 1 }};
+                if (trs->translation != zero)
+                    appendFloatArrayField(json, "translation", trs->translation.data(), 3);
+                if (trs->rotation != identityRotation)
+                    appendFloatArrayField(json, "rotation", trs->rotation.data(), 4);
+                if (trs->scale != one)
+                    appendFloatArrayField(json, "scale", trs->scale.data(), 3);
+            } else if (const auto* matrix = std::get_if<Node::TransformMatrix>(&node.transform); matrix != nullptr) {
+                constexpr Node::TransformMatrix identity = {{
+                    1, 0, 0, 0,
+                    0, 1, 0, 0,
+                    0, 0, 1, 0,
+                    0, 0, 0, 1,
+                }};
+                if (*matrix != identity)
+                    appendFloatArrayField(json, "matrix", matrix->data(), 16);
+            }
+            if (!node.weights.empty())
+                appendFloatArrayField(json, "weights", node.weights.data(), node.weights.size());
+            appendNameField(json, node.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendScenes(std::string& json, const Asset& asset) {
+        appendKey(json, "scenes");
+        json += '[';
+        for (std::size_t i = 0; i < asset.scenes.size(); ++i) {
+            const auto& scene = asset.scenes[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (!scene.nodeIndices.empty())
+                appendIndexArrayField(json, "nodes", scene.nodeIndices);
+            appendNameField(json, scene.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendSkins(std::string& json, const Asset& asset) {
+        appendKey(json, "skins");
+        json += '[';
+        for (std::size_t i = 0; i < asset.skins.size(); ++i) {
+            const auto& skin = asset.skins[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (skin.inverseBindMatrices.has_value())
+                appendUIntField(json, "inverseBindMatrices", skin.inverseBindMatrices.value());
+            if (skin.skeleton.has_value())
+                appendUIntField(json, "skeleton", skin.skeleton.value());
+            appendIndexArrayField(json, "joints", skin.joints);
+            appendNameField(json, skin.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendAnimations(std::string& json, const Asset& asset) {
+        appendKey(json, "animations");
+        json += '[';
+        for (std::size_t i = 0; i < asset.animations.size(); ++i) {
+            const auto& animation = asset.animations[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            appendKey(json, "channels");
+            json += '[';
+            for (std::size_t j = 0; j < animation.channels.size(); ++j) {
+                const auto& channel = animation.channels[j];
+                if (j != 0)
+                    json += ',';
+                json += '{';
+                appendUIntField(json, "sampler", channel.samplerIndex);
+                appendKey(json, "target");
+                json += '{';
+                appendUIntField(json, "node", channel.nodeIndex);
+                switch (channel.path) {
+                    case AnimationPath::Translation: appendStringField(json, "path", "translation"); break;
+                    case AnimationPath::Rotation: appendStringField(json, "path", "rotation"); break;
+                    case AnimationPath::Scale: appendStringField(json, "path", "scale"); break;
+                    case AnimationPath::Weights: appendStringField(json, "path", "weights"); break;
+                }
+                json += '}';
+                json += '}';
+            }
+            json += ']';
+            appendKey(json, "samplers");
+            json += '[';
+            for (std::size_t j = 0; j < animation.samplers.size(); ++j) {
+                const auto& sampler = animation.samplers[j];
+                if (j != 0)
+                    json += ',';
+                json += '{';
+                appendUIntField(json, "input", sampler.inputAccessor);
+                if (sampler.interpolation == AnimationInterpolation::Step) {
+                    appendStringField(json, "interpolation", "STEP");
+                } else if (sampler.interpolation == AnimationInterpolation::CubicSpline) {
+                    appendStringField(json, "interpolation", "CUBICSPLINE");
+                }
+                appendUIntField(json, "output", sampler.outputAccessor);
+                json += '}';
+            }
+            json += ']';
+            appendNameField(json, animation.name);
+            json += '}';
+        }
+        json += ']';
+    }
+
+    void appendCameras(std::string& json, const Asset& asset) {
+        appendKey(json, "cameras");
+        json += '[';
+        for (std::size_t i = 0; i < asset.cameras.size(); ++i) {
+            const auto& camera = asset.cameras[i];
+            if (i != 0)
+                json += ',';
+            json += '{';
+            if (const auto* perspective = std::get_if<Camera::Perspective>(&camera.camera); perspective != nullptr) {
+                appendStringField(json, "type", "perspective");
+                appendKey(json, "perspective");
+                json += '{';
+                if (perspective->aspectRatio.has_value())
+                    appendFloatField(json, "aspectRatio", perspective->aspectRatio.value());
+                appendFloatField(json, "yfov", perspective->yfov);
+                if (perspective->zfar.has_value())
+                    appendFloatField(json, "zfar", perspective->zfar.value());
+                appendFloatField(json, "znear", perspective->znear);
+                json += '}';
+            } else if (const auto* orthographic = std::get_if<Camera::Orthographic>(&camera.camera); orthographic != nullptr) {
+                appendStringField(json, "type", "orthographic");
+                appendKey(json, "orthographic");
+                json += '{';
+                appendFloatField(json, "xmag", orthographic->xmag);
+                appendFloatField(json, "ymag", orthographic->ymag);
+                appendFloatField(json, "zfar", orthographic->zfar);
+                appendFloatField(json, "znear", orthographic->znear);
+                json += '}';
+            }
+            appendNameField(json, camera.name);
+            json += '}';
+        }
+        json += ']';
+    }
+#pragma endregion
+} // namespace fastgltf
+
+fg::Error fg::Exporter::writeJson(const Asset& asset, bool binaryBuffer) {
+    auto& json = jsonBuffer;
+    json.clear();
+
+    // Rough estimate to avoid most regrowth while emitting. The bulk of typical assets are
+    // accessors, nodes, and mesh primitives.
+    json.reserve(512 + 192 * (asset.accessors.size() + asset.bufferViews.size()
+        + asset.nodes.size() + asset.meshes.size() + asset.materials.size() + asset.animations.size()));
+
+    json += '{';
+    appendKey(json, "asset");
+    json += '{';
+    if (asset.assetInfo.has_value()) {
+        const auto& info = asset.assetInfo.value();
+        appendStringField(json, "version", info.gltfVersion.empty()
+            ? std::string_view { "2.0" } : std::string_view { info.gltfVersion.data(), info.gltfVersion.size() });
+        if (!info.copyright.empty())
+            appendStringField(json, "copyright", std::string_view { info.copyright.data(), info.copyright.size() });
+        if (!info.generator.empty())
+            appendStringField(json, "generator", std::string_view { info.generator.data(), info.generator.size() });
+    } else {
+        appendStringField(json, "version", "2.0");
+    }
+    json += '}';
+
+    if (!asset.buffers.empty()) {
+        if (auto error = appendBuffers(json, asset, binaryBuffer); error != Error::None)
+            return error;
+    }
+    if (!asset.bufferViews.empty())
+        appendBufferViews(json, asset);
+    if (!asset.accessors.empty())
+        appendAccessors(json, asset);
+    if (!asset.images.empty()) {
+        if (auto error = appendImages(json, asset); error != Error::None)
+            return error;
+    }
+    if (!asset.samplers.empty())
+        appendSamplers(json, asset);
+    if (!asset.textures.empty())
+        appendTextures(json, asset);
+    if (!asset.materials.empty())
+        appendMaterials(json, asset);
+    if (!asset.meshes.empty())
+        appendMeshes(json, asset);
+    if (!asset.cameras.empty())
+        appendCameras(json, asset);
+    if (!asset.skins.empty())
+        appendSkins(json, asset);
+    if (!asset.animations.empty())
+        appendAnimations(json, asset);
+    if (!asset.nodes.empty())
+        appendNodes(json, asset);
+    if (!asset.scenes.empty())
+        appendScenes(json, asset);
+    if (asset.defaultScene.has_value())
+        appendUIntField(json, "scene", asset.defaultScene.value());
+    json += '}';
+    return Error::None;
+}
+
+fg::Expected<std::vector<std::uint8_t>> fg::Exporter::writeBinaryGLTF(const Asset& asset) {
+    using OutputType = std::vector<std::uint8_t>;
+
+    auto binaryBuffer = !asset.buffers.empty() && getSourceByteSpan(asset.buffers.front().data).data() != nullptr;
+    if (auto error = writeJson(asset, binaryBuffer); error != Error::None)
+        return Expected<OutputType>(error);
+
+    span<const std::byte> binData = {};
+    std::size_t binLength = 0;
+    if (binaryBuffer) {
+        binData = getSourceByteSpan(asset.buffers.front().data);
+        binLength = asset.buffers.front().byteLength;
+        if (binData.size() < binLength)
+            return Expected<OutputType>(Error::InvalidGltf);
+    }
+
+    auto jsonPadded = alignToChunk(jsonBuffer.size());
+    auto binPadded = alignToChunk(binLength);
+    auto totalSize = sizeof(std::uint32_t) * 3 + sizeof(std::uint32_t) * 2 + jsonPadded;
+    if (binaryBuffer)
+        totalSize += sizeof(std::uint32_t) * 2 + binPadded;
+    if (totalSize > std::numeric_limits<std::uint32_t>::max())
+        return Expected<OutputType>(Error::InvalidGltf);
+
+    // Zero-initialisation also provides the BIN chunk padding for free.
+    OutputType output(totalSize);
+    auto* dst = output.data();
+    appendLE32(dst + 0, exportGltfHeaderMagic);
+    appendLE32(dst + 4, 2); // GLB container version.
+    appendLE32(dst + 8, static_cast<std::uint32_t>(totalSize));
+    dst += 12;
+
+    appendLE32(dst + 0, static_cast<std::uint32_t>(jsonPadded));
+    appendLE32(dst + 4, exportGltfJsonChunkMagic);
+    dst += 8;
+    std::memcpy(dst, jsonBuffer.data(), jsonBuffer.size());
+    std::memset(dst + jsonBuffer.size(), ' ', jsonPadded - jsonBuffer.size());
+    dst += jsonPadded;
+
+    if (binaryBuffer) {
+        appendLE32(dst + 0, static_cast<std::uint32_t>(binPadded));
+        appendLE32(dst + 4, exportGltfDataChunkMagic);
+        dst += 8;
+        std::memcpy(dst, binData.data(), binLength);
+    }
+
+    return Expected<OutputType>(std::move(output));
+}
+
+fg::Error fg::Exporter::writeBinaryGLTF(const Asset& asset, const fs::path& path) {
+    auto binaryBuffer = !asset.buffers.empty() && getSourceByteSpan(asset.buffers.front().data).data() != nullptr;
+    if (auto error = writeJson(asset, binaryBuffer); error != Error::None)
+        return error;
+
+    span<const std::byte> binData = {};
+    std::size_t binLength = 0;
+    if (binaryBuffer) {
+        binData = getSourceByteSpan(asset.buffers.front().data);
+        binLength = asset.buffers.front().byteLength;
+        if (binData.size() < binLength)
+            return Error::InvalidGltf;
+    }
+
+    auto jsonPadded = alignToChunk(jsonBuffer.size());
+    auto binPadded = alignToChunk(binLength);
+    auto totalSize = sizeof(std::uint32_t) * 3 + sizeof(std::uint32_t) * 2 + jsonPadded;
+    if (binaryBuffer)
+        totalSize += sizeof(std::uint32_t) * 2 + binPadded;
+    if (totalSize > std::numeric_limits<std::uint32_t>::max())
+        return Error::InvalidGltf;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+        return Error::InvalidPath;
+
+    writeLE32(file, exportGltfHeaderMagic);
+    writeLE32(file, 2); // GLB container version.
+    writeLE32(file, static_cast<std::uint32_t>(totalSize));
+
+    constexpr std::array<char, 3> spacePadding = {{ ' ', ' ', ' ' }};
+    writeLE32(file, static_cast<std::uint32_t>(jsonPadded));
+    writeLE32(file, exportGltfJsonChunkMagic);
+    file.write(jsonBuffer.data(), static_cast<std::streamsize>(jsonBuffer.size()));
+    file.write(spacePadding.data(), static_cast<std::streamsize>(jsonPadded - jsonBuffer.size()));
+
+    if (binaryBuffer) {
+        // The buffer bytes are gathered straight from the asset's data source, so even
+        // multi-hundred-megabyte BIN chunks never get staged in a temporary allocation.
+        constexpr std::array<char, 3> zeroPadding = {{ 0, 0, 0 }};
+        writeLE32(file, static_cast<std::uint32_t>(binPadded));
+        writeLE32(file, exportGltfDataChunkMagic);
+        file.write(reinterpret_cast<const char*>(binData.data()), static_cast<std::streamsize>(binLength));
+        file.write(zeroPadding.data(), static_cast<std::streamsize>(binPadded - binLength));
+    }
+
+    return file.good() ? Error::None : Error::InvalidPath;
+}
+
+fg::Expected<std::string> fg::Exporter::writeGltfJson(const Asset& asset) {
+    if (auto error = writeJson(asset, false); error != Error::None)
+        return Expected<std::string>(error);
+    // Copy instead of moving so that the internal buffer keeps its capacity for the next export.
+    return Expected<std::string>(std::string { jsonBuffer });
+}
@@ -29,16 +29,48 @@
 #endif
 
 #include <array>
+#include <chrono>
 #include <cmath>
 #include <fstream>
 #include <functional>
 #include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #if __ANDROID__
 #include <android/asset_manager.h>
 #endif
 
+#if !defined(FASTGLTF_ENABLE_MESHOPT)
+#define FASTGLTF_ENABLE_MESHOPT 0
+#endif
+#if FASTGLTF_ENABLE_MESHOPT
+#include <meshoptimizer.h>
+#endif
+
+#if !defined(FASTGLTF_ENABLE_DRACO)
+#define FASTGLTF_ENABLE_DRACO 0
+#endif
+#if FASTGLTF_ENABLE_DRACO
+#include <draco/compression/decode.h>
+#endif
+
+// For MappedGltfDataBuffer.
+#if defined(_WIN32)
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #ifdef _MSC_VER
 #pragma warning(push)
 #pragma warning(disable : 5030) // attribute 'x' is not recognized
@@ -91,6 +123,26 @@ namespace fastgltf {
     using CRCFunction = std::uint32_t(*)(const std::uint8_t*, std::size_t);
     using CRCStringFunction = std::uint32_t(*)(std::string_view str);
 
+#if FASTGLTF_ENABLE_STATS
+    // Span names for the category parse functions, indexed by the bit position of the category.
+    constexpr std::array<std::string_view, 13> categorySpanNames = {
+        "buffers", "bufferViews", "accessors", "images", "samplers", "textures",
+        "animations", "cameras", "materials", "meshes", "skins", "nodes", "scenes",
+    };
+
+    std::size_t categoryIndex(Category category) noexcept {
+        std::size_t index = 0;
+        for (auto value = to_underlying(category); (value >>= 1) != 0;)
+            ++index;
+        return index;
+    }
+
+    std::uint64_t elapsedNanoseconds(std::chrono::steady_clock::time_point begin) noexcept {
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - begin).count());
+    }
+#endif
+
 #if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
     [[gnu::hot, gnu::const, gnu::target("sse4.2")]] std::uint32_t hwcrc32c(std::string_view str) noexcept {
         return hwcrc32c(reinterpret_cast<const std::uint8_t*>(str.data()), str.size());
@@ -173,7 +225,7 @@ namespace fastgltf {
 	}
 
 	[[nodiscard, gnu::always_inline]] inline bool parseTextureExtensions(Texture& texture, simdjson::dom::object& extensions, Extensions extensionFlags) {
-		if (hasBit(extensionFlags, Extensions::KHR_texture_basisu)) {
+		if (hasCompiledBit<Extensions::KHR_texture_basisu>(extensionFlags)) {
 			auto [invalidGltf, extensionNotPresent, imageIndex] = getImageIndexForExtension(extensions, extensions::KHR_texture_basisu);
 			if (invalidGltf) {
 				return false;
@@ -185,7 +237,7 @@ namespace fastgltf {
 			}
 		}
 
-		if (hasBit(extensionFlags, Extensions::MSFT_texture_dds)) {
+		if (hasCompiledBit<Extensions::MSFT_texture_dds>(extensionFlags)) {
 			auto [invalidGltf, extensionNotPresent, imageIndex] = getImageIndexForExtension(extensions, extensions::MSFT_texture_dds);
 			if (invalidGltf) {
 				return false;
@@ -197,7 +249,7 @@ namespace fastgltf {
 			}
 		}
 
-		if (hasBit(extensionFlags, Extensions::EXT_texture_webp)) {
+		if (hasCompiledBit<Extensions::EXT_texture_webp>(extensionFlags)) {
 			auto [invalidGltf, extensionNotPresent, imageIndex] = getImageIndexForExtension(extensions, extensions::EXT_texture_webp);
 			if (invalidGltf) {
 				return false;
@@ -260,7 +312,7 @@ namespace fastgltf {
 		dom::object extensionsObject;
 		if (child["extensions"].get_object().get(extensionsObject) == SUCCESS) {
 			dom::object textureTransform;
-			if (hasBit(extensions, Extensions::KHR_texture_transform) && extensionsObject[extensions::KHR_texture_transform].get_object().get(textureTransform) == SUCCESS) {
+			if (hasCompiledBit<Extensions::KHR_texture_transform>(extensions) && extensionsObject[extensions::KHR_texture_transform].get_object().get(textureTransform) == SUCCESS) {
 				auto transform = std::make_unique<TextureTransform>();
 				transform->rotation = 0.0F;
 				transform->uvOffset = {{ 0.0F, 0.0F }};
@@ -459,7 +511,13 @@ fg::URI::URI(std::string_view uri) noexcept : uri(uri) {
 }
 
 fg::URI::URI(fastgltf::URIView view) noexcept : uri(view.view) {
-	readjustViews(view);
+	if (uri.find('%') == std::pmr::string::npos) {
+		// No escapes, the sub-views can simply be rebased onto our copy of the string.
+		readjustViews(view);
+	} else {
+		decodePercents(this->uri);
+		this->view = this->uri; // Also parses.
+	}
 }
 
 // Some C++ stdlib implementations copy in some cases when moving strings, which invalidates the
@@ -469,8 +527,13 @@ fg::URI::URI(const URI& other) {
 	*this = other;
 }
 
-fg::URI::URI(URI&& other) noexcept {
-	*this = other;
+// Move-construct the string in the initializer list so that its allocator is carried over. This
+// keeps URIs that were allocated from an asset's memory resource on that resource; the move
+// assignment operator below would copy the characters into the default resource instead.
+fg::URI::URI(URI&& other) noexcept : uri(std::move(other.uri)) {
+	view._valid = other.view._valid;
+	other.view._valid = false;
+	readjustViews(other.view);
 }
 
 fg::URI& fg::URI::operator=(const URI& other) {
@@ -482,7 +545,12 @@ fg::URI& fg::URI::operator=(const URI& other) {
 
 fg::URI& fg::URI::operator=(const URIView& other) {
 	uri = other.view;
-	readjustViews(other);
+	if (uri.find('%') == std::pmr::string::npos) {
+		readjustViews(other);
+	} else {
+		decodePercents(uri);
+		view = uri; // Also parses.
+	}
 	return *this;
 }
 
@@ -521,14 +589,28 @@ void fg::URI::readjustViews(const URIView& other) {
 }
 
 void fg::URI::decodePercents(std::pmr::string& x) noexcept {
-	for (auto it = x.begin(); it != x.end(); ++it) {
-		if (*it == '%') {
-			// Read the next two chars and store them.
-			std::array<char, 3> chars = {*(it + 1), *(it + 2), 0};
-			*it = static_cast<char>(std::strtoul(chars.data(), nullptr, 16));
-			x.erase(it + 1, it + 3);
+	// The vast majority of URIs contain no escapes at all, so check before touching anything.
+	auto first = x.find('%');
+	if (first == std::pmr::string::npos) {
+		return;
+	}
+
+	// Decode in a single pass with separate read and write cursors instead of calling erase for
+	// every escape, which would shift the entire tail of the string each time.
+	auto* write = x.data() + first;
+	const auto* read = x.data() + first;
+	const auto* end = x.data() + x.size();
+	while (read != end) {
+		if (*read == '%' && end - read >= 3) {
+			// Read the next two chars and decode them.
+			std::array<char, 3> chars = {read[1], read[2], 0};
+			*write++ = static_cast<char>(std::strtoul(chars.data(), nullptr, 16));
+			read += 3;
+		} else {
+			*write++ = *read++;
 		}
 	}
+	x.resize(static_cast<std::size_t>(write - x.data()));
 }
 
 std::string_view fg::URI::string() const noexcept { return uri; }
@@ -557,6 +639,178 @@ bool fg::URI::isDataUri() const noexcept {
 }
 #pragma endregion
 
+#pragma region Asset
+void fg::Asset::compact() {
+	// Size the replacement arena from what the old one actually handed out, which is an upper
+	// bound on the live data since it includes intermediate allocations that parsing no longer
+	// references. A single block of that size fits everything we are about to move over.
+	std::size_t initialBlockSize = ChunkMemoryResource::defaultBlockSize;
+	if (memoryResource != nullptr && memoryResource->bytesAllocated() > initialBlockSize) {
+		initialBlockSize = memoryResource->bytesAllocated();
+	}
+	auto newResource = std::make_shared<ChunkMemoryResource>(initialBlockSize);
+	std::pmr::polymorphic_allocator<std::byte> alloc(newResource.get());
+
+	// pmr containers keep their allocator on move assignment and would copy the data back into
+	// the old arena, so replacements have to be move-constructed over the destroyed old object.
+	auto reconstruct = [](auto& target, auto&& replacement) {
+		using Target = std::remove_reference_t<decltype(target)>;
+		target.~Target();
+		new (&target) Target(std::move(replacement));
+	};
+
+	auto compactString = [&](std::pmr::string& string) {
+		reconstruct(string, std::pmr::string(string, alloc));
+	};
+
+	auto compactVector = [&](auto& vector) {
+		std::remove_reference_t<decltype(vector)> replacement(alloc);
+		replacement.reserve(vector.size());
+		for (auto& element : vector) {
+			replacement.emplace_back(std::move(element));
+		}
+		reconstruct(vector, std::move(replacement));
+	};
+
+	// Attribute lists pair pmr strings with indices, and the strings have to be rebuilt on the
+	// new arena individually as moving the pairs would just carry the old allocator along.
+	auto compactAttributes = [&](auto& attributes) {
+		std::remove_reference_t<decltype(attributes)> replacement(alloc);
+		replacement.reserve(attributes.size());
+		for (auto& [attributeName, accessorIndex] : attributes) {
+			replacement.emplace_back(std::pmr::string(attributeName, alloc), accessorIndex);
+		}
+		reconstruct(attributes, std::move(replacement));
+	};
+
+	auto compactMinMax = [&](auto& variant) {
+		if (auto* doubles = std::get_if<std::pmr::vector<double>>(&variant); doubles != nullptr) {
+			compactVector(*doubles);
+		} else if (auto* ints = std::get_if<std::pmr::vector<std::int64_t>>(&variant); ints != nullptr) {
+			compactVector(*ints);
+		}
+	};
+
+	auto compactDataSource = [&](DataSource& data) {
+		if (auto* uri = std::get_if<sources::URI>(&data); uri != nullptr) {
+			// Rebuilding through the pmr string constructor re-parses the already decoded
+			// string, which is harmless as the decoded form contains no escapes to decode.
+			sources::URI replacement = { uri->fileByteOffset,
+					URI(std::pmr::string(uri->uri.string(), alloc)), uri->mimeType };
+			data.emplace<sources::URI>(std::move(replacement));
+		} else if (auto* vector = std::get_if<sources::Vector>(&data); vector != nullptr) {
+			vector->bytes.shrink_to_fit();
+		}
+	};
+
+	if (assetInfo.has_value()) {
+		compactString(assetInfo->gltfVersion);
+		compactString(assetInfo->copyright);
+		compactString(assetInfo->generator);
+	}
+
+	for (auto& accessor : accessors) {
+		compactMinMax(accessor.max);
+		compactMinMax(accessor.min);
+		compactString(accessor.name);
+	}
+	accessors.shrink_to_fit();
+
+	for (auto& animation : animations) {
+		compactVector(animation.channels);
+		compactVector(animation.samplers);
+		compactString(animation.name);
+	}
+	animations.shrink_to_fit();
+
+	for (auto& buffer : buffers) {
+		compactDataSource(buffer.data);
+		compactString(buffer.name);
+	}
+	buffers.shrink_to_fit();
+
+	for (auto& bufferView : bufferViews) {
+		compactString(bufferView.name);
+	}
+	bufferViews.shrink_to_fit();
+
+	for (auto& camera : cameras) {
+		compactString(camera.name);
+	}
+	cameras.shrink_to_fit();
+
+	for (auto& image : images) {
+		compactDataSource(image.data);
+		compactString(image.name);
+	}
+	images.shrink_to_fit();
+
+	for (auto& light : lights) {
+		compactString(light.name);
+	}
+	lights.shrink_to_fit();
+
+	for (auto& material : materials) {
+		compactString(material.name);
+	}
+	materials.shrink_to_fit();
+
+	for (auto& mesh : meshes) {
+		for (auto& primitive : mesh.primitives) {
+			compactAttributes(primitive.attributes);
+			for (auto& target : primitive.targets) {
+				compactAttributes(target);
+			}
+			compactVector(primitive.targets);
+			if (primitive.dracoCompression != nullptr) {
+				compactAttributes(primitive.dracoCompression->attributes);
+			}
+		}
+		// The primitives themselves move over wholesale; their members were rebuilt above and
+		// carry their new allocators along through the move.
+		compactVector(mesh.primitives);
+		compactVector(mesh.weights);
+		compactString(mesh.name);
+	}
+	meshes.shrink_to_fit();
+
+	for (auto& node : nodes) {
+		compactVector(node.children);
+		compactVector(node.weights);
+		compactString(node.name);
+	}
+	nodes.shrink_to_fit();
+
+	for (auto& sampler : samplers) {
+		compactString(sampler.name);
+	}
+	samplers.shrink_to_fit();
+
+	for (auto& scene : scenes) {
+		compactVector(scene.nodeIndices);
+		compactString(scene.name);
+	}
+	scenes.shrink_to_fit();
+
+	for (auto& skin : skins) {
+		compactVector(skin.joints);
+		compactString(skin.name);
+	}
+	skins.shrink_to_fit();
+
+	for (auto& texture : textures) {
+		compactString(texture.name);
+	}
+	textures.shrink_to_fit();
+
+	// The name index holds views into names that just got relocated.
+	nameIndex.reset();
+
+	// Everything now lives on the new arena, so the parse-time arena can finally be released.
+	memoryResource = std::move(newResource);
+}
+#pragma endregion
+
 #pragma region glTF parsing
 fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexcept {
     auto path = uri.path();
@@ -570,6 +824,16 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
     }
 
     auto encodedData = path.substr(encodingEnd + 1);
+#if FASTGLTF_ENABLE_STATS
+    auto decodeBegin = std::chrono::steady_clock::now();
+    auto recordDecode = [&](std::size_t decodedBytes) {
+        auto nanoseconds = elapsedNanoseconds(decodeBegin);
+        statsCollector->base64DecodeNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        statsCollector->base64DecodedBytes.fetch_add(decodedBytes, std::memory_order_relaxed);
+        if (config.spanCallback != nullptr)
+            config.spanCallback("base64_decode", nanoseconds, config.userPointer);
+    };
+#endif
     if (config.mapCallback != nullptr) {
         // If a map callback is specified, we use a pointer to memory specified by it.
         auto padding = base64::getPadding(encodedData);
@@ -578,6 +842,8 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
         if (info.mappedMemory != nullptr) {
             if (config.decodeCallback != nullptr) {
                 config.decodeCallback(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding, size, config.userPointer);
+            } else if (hasBit(options, Options::ParallelParse)) {
+                base64::decode_inplace_parallel(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding, std::thread::hardware_concurrency());
             } else {
                 base64::decode_inplace(encodedData, reinterpret_cast<std::uint8_t*>(info.mappedMemory), padding);
             }
@@ -586,6 +852,9 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
                 config.unmapCallback(&info, config.userPointer);
             }
 
+#if FASTGLTF_ENABLE_STATS
+            recordDecode(size);
+#endif
             sources::CustomBuffer source = {};
             source.id = info.customId;
             source.mimeType = getMimeTypeFromString(mime);
@@ -599,17 +868,24 @@ fg::Expected<fg::DataSource> fg::Parser::decodeDataUri(URIView& uri) const noexc
         auto padding = base64::getPadding(encodedData);
         uriData.resize(base64::getOutputSize(encodedData.size(), padding));
         config.decodeCallback(encodedData, uriData.data(), padding, uriData.size(), config.userPointer);
+    } else if (hasBit(options, Options::ParallelParse)) {
+        auto padding = base64::getPadding(encodedData);
+        uriData.resize(base64::getOutputSize(encodedData.size(), padding));
+        base64::decode_inplace_parallel(encodedData, uriData.data(), padding, std::thread::hardware_concurrency());
     } else {
         uriData = base64::decode(encodedData);
     }
 
+#if FASTGLTF_ENABLE_STATS
+    recordDecode(uriData.size());
+#endif
     sources::Vector source = {};
     source.mimeType = getMimeTypeFromString(mime);
     source.bytes = std::move(uriData);
 	return Expected<DataSource> { std::move(source) };
 }
 
-fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noexcept {
+fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri, Asset& asset) const noexcept {
     auto path = directory / uri.path();
     std::error_code error;
     // If we were instructed to load external buffers and the files don't exist, we'll return an error.
@@ -622,7 +898,45 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
 	    return Expected<DataSource> { Error::InvalidURI };
     }
 
+    // When the application wants to fulfill the reads itself, just hand it the file and record
+    // the returned id. The read may still be in flight when we continue parsing; it only has to
+    // be finished by the time the join callback returns.
+    if (config.loadCallback != nullptr) {
+        const sources::CustomBuffer customBufferSource = {
+            config.loadCallback(path, static_cast<std::uint64_t>(length), config.userPointer),
+            MimeType::None,
+        };
+        return Expected<DataSource> { customBufferSource };
+    }
+
+    // Map the file instead of copying it through a stream when requested. The asset takes
+    // ownership of the mapping so that the ByteView stays valid for its whole lifetime; this
+    // keeps multi-gigabyte payloads, which std::size_t addresses fully on 64-bit targets, from
+    // ever being read into an intermediate allocation.
+    if (hasBit(options, Options::MapExternalBuffers)) {
+        auto mapping = std::make_shared<MappedGltfDataBuffer>();
+        if (mapping->mapFromFile(path)) {
+            auto bytes = static_cast<span<std::byte>>(*mapping);
+            sources::ByteView byteViewSource = {
+                span<const std::byte>(bytes.data(), bytes.size()),
+                MimeType::GltfBuffer,
+            };
+            asset.bufferMappings.emplace_back(std::move(mapping));
+            return Expected<DataSource> { byteViewSource };
+        }
+        // Mapping can fail when the address space is exhausted; fall through to the stream read.
+    }
+
     std::ifstream file(path, std::ios::binary);
+#if FASTGLTF_ENABLE_STATS
+    auto readBegin = std::chrono::steady_clock::now();
+    auto recordRead = [&]() {
+        auto nanoseconds = elapsedNanoseconds(readBegin);
+        statsCollector->fileReadNanoseconds.fetch_add(nanoseconds, std::memory_order_relaxed);
+        if (config.spanCallback != nullptr)
+            config.spanCallback("file_read", nanoseconds, config.userPointer);
+    };
+#endif
 
     if (config.mapCallback != nullptr) {
         auto info = config.mapCallback(static_cast<std::uint64_t>(length), config.userPointer);
@@ -633,6 +947,9 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
                 config.unmapCallback(&info, config.userPointer);
             }
 
+#if FASTGLTF_ENABLE_STATS
+            recordRead();
+#endif
 	        return Expected<DataSource> { customBufferSource };
         }
     }
@@ -641,6 +958,9 @@ fg::Expected<fg::DataSource> fg::Parser::loadFileFromUri(URIView& uri) const noe
     vectorSource.mimeType = MimeType::GltfBuffer;
     vectorSource.bytes.resize(length);
     file.read(reinterpret_cast<char*>(vectorSource.bytes.data()), length);
+#if FASTGLTF_ENABLE_STATS
+    recordRead();
+#endif
 	return Expected<DataSource> { std::move(vectorSource) };
 }
 
@@ -701,267 +1021,362 @@ fg::MimeType fg::Parser::getMimeTypeFromString(std::string_view mime) {
 }
 
 fg::Error fg::Parser::validate(const fastgltf::Asset& asset) const {
-	for (const auto& accessor : asset.accessors) {
-		if (accessor.type == AccessorType::Invalid)
-			return Error::InvalidGltf;
-		if (accessor.componentType == ComponentType::Invalid)
-			return Error::InvalidGltf;
-		if (accessor.count < 1)
-			return Error::InvalidGltf;
-		if (accessor.bufferViewIndex.has_value() &&
-		    accessor.bufferViewIndex.value() >= asset.bufferViews.size())
-			return Error::InvalidGltf;
-
-		if (!std::holds_alternative<std::monostate>(accessor.max)) {
-			if ((accessor.componentType == ComponentType::Float || accessor.componentType == ComponentType::Double)
-			    && !std::holds_alternative<std::pmr::vector<double>>(accessor.max))
+	auto validateAccessors = [&]() -> Error {
+		for (const auto& accessor : asset.accessors) {
+			if (accessor.type == AccessorType::Invalid)
 				return Error::InvalidGltf;
-		}
-		if (!std::holds_alternative<std::monostate>(accessor.min)) {
-			if ((accessor.componentType == ComponentType::Float || accessor.componentType == ComponentType::Double)
-			    && !std::holds_alternative<std::pmr::vector<double>>(accessor.min))
+			if (accessor.componentType == ComponentType::Invalid)
+				return Error::InvalidGltf;
+			if (accessor.count < 1)
+				return Error::InvalidGltf;
+			if (accessor.bufferViewIndex.has_value() &&
+			    accessor.bufferViewIndex.value() >= asset.bufferViews.size())
+				return Error::InvalidGltf;
+			// This rule is checked during parsing unless Options::TrustedInput skipped it.
+			if (accessor.normalized
+			    && (accessor.componentType == ComponentType::UnsignedInt || accessor.componentType == ComponentType::Float))
 				return Error::InvalidGltf;
-		}
-	}
-
-	for (const auto& animation : asset.animations) {
-		if (animation.channels.empty())
-			return Error::InvalidGltf;
-		if (animation.samplers.empty())
-			return Error::InvalidGltf;
-	}
-
-	for (const auto& buffer : asset.buffers) {
-		if (buffer.byteLength < 1)
-			return Error::InvalidGltf;
-	}
-
-	for (const auto& bufferView : asset.bufferViews) {
-		if (bufferView.byteLength < 1)
-			return Error::InvalidGltf;
-		if (bufferView.byteStride.has_value() && (bufferView.byteStride < 4U || bufferView.byteStride > 252U))
-			return Error::InvalidGltf;
-		if (bufferView.bufferIndex >= asset.buffers.size())
-			return Error::InvalidGltf;
-
-		if (bufferView.meshoptCompression != nullptr && hasBit(config.extensions, Extensions::EXT_meshopt_compression))
-			return Error::InvalidGltf;
 
-		if (bufferView.meshoptCompression) {
-			const auto& compression = bufferView.meshoptCompression;
-			switch (compression->mode) {
-				case MeshoptCompressionMode::Attributes:
-					if (compression->byteStride % 4 != 0 || compression->byteStride > 256)
-						return Error::InvalidGltf;
-					break;
-				case MeshoptCompressionMode::Triangles:
-					if (compression->count % 3 != 0)
-						return Error::InvalidGltf;
-					[[fallthrough]];
-				case MeshoptCompressionMode::Indices:
-					if (compression->byteStride != 2 && compression->byteStride != 4)
-						return Error::InvalidGltf;
-					break;
-				case MeshoptCompressionMode::None:
-					break;
+			if (!std::holds_alternative<std::monostate>(accessor.max)) {
+				if ((accessor.componentType == ComponentType::Float || accessor.componentType == ComponentType::Double)
+				    && !std::holds_alternative<std::pmr::vector<double>>(accessor.max))
+					return Error::InvalidGltf;
+			}
+			if (!std::holds_alternative<std::monostate>(accessor.min)) {
+				if ((accessor.componentType == ComponentType::Float || accessor.componentType == ComponentType::Double)
+				    && !std::holds_alternative<std::pmr::vector<double>>(accessor.min))
+					return Error::InvalidGltf;
 			}
 		}
-	}
+		return Error::None;
+	};
 
-	for (const auto& camera : asset.cameras) {
-		if (const auto* pOrthographic = std::get_if<Camera::Orthographic>(&camera.camera)) {
-			if (pOrthographic->zfar == 0)
+	auto validateAnimations = [&]() -> Error {
+		for (const auto& animation : asset.animations) {
+			if (animation.channels.empty())
 				return Error::InvalidGltf;
-		} else if (const auto* pPerspective = std::get_if<Camera::Perspective>(&camera.camera)) {
-			if (pPerspective->aspectRatio.has_value() && pPerspective->aspectRatio == .0f)
+			if (animation.samplers.empty())
+				return Error::InvalidGltf;
+		}
+		return Error::None;
+	};
+
+	auto validateBuffers = [&]() -> Error {
+		for (const auto& buffer : asset.buffers) {
+			if (buffer.byteLength < 1)
 				return Error::InvalidGltf;
-			if (pPerspective->yfov == 0)
+		}
+		return Error::None;
+	};
+
+	auto validateBufferViews = [&]() -> Error {
+		for (const auto& bufferView : asset.bufferViews) {
+			if (bufferView.byteLength < 1)
 				return Error::InvalidGltf;
-			if (pPerspective->zfar.has_value() && pPerspective->zfar == .0f)
+			if (bufferView.byteStride.has_value() && (bufferView.byteStride < 4U || bufferView.byteStride > 252U))
 				return Error::InvalidGltf;
-			if (pPerspective->znear == 0.0F)
+			if (bufferView.bufferIndex >= asset.buffers.size())
 				return Error::InvalidGltf;
-		}
-	}
 
-	for (const auto& image : asset.images) {
-		if (const auto* view = std::get_if<sources::BufferView>(&image.data); view != nullptr) {
-			if (view->bufferViewIndex >= asset.bufferViews.size()) {
+			if (bufferView.meshoptCompression != nullptr && hasCompiledBit<Extensions::EXT_meshopt_compression>(config.extensions))
 				return Error::InvalidGltf;
+
+			if (bufferView.meshoptCompression) {
+				const auto& compression = bufferView.meshoptCompression;
+				switch (compression->mode) {
+					case MeshoptCompressionMode::Attributes:
+						if (compression->byteStride % 4 != 0 || compression->byteStride > 256)
+							return Error::InvalidGltf;
+						break;
+					case MeshoptCompressionMode::Triangles:
+						if (compression->count % 3 != 0)
+							return Error::InvalidGltf;
+						[[fallthrough]];
+					case MeshoptCompressionMode::Indices:
+						if (compression->byteStride != 2 && compression->byteStride != 4)
+							return Error::InvalidGltf;
+						break;
+					case MeshoptCompressionMode::None:
+						break;
+				}
 			}
 		}
-	}
+		return Error::None;
+	};
 
-	for (const auto& material : asset.materials) {
-		auto isInvalidTexture = [&textures = asset.textures](std::optional<std::size_t> textureIndex) {
-			return textureIndex.has_value() && textureIndex.value() >= textures.size();
-		};
-		if (material.normalTexture.has_value() && isInvalidTexture(material.normalTexture->textureIndex))
-			return Error::InvalidGltf;
-		if (material.emissiveTexture.has_value() && isInvalidTexture(material.emissiveTexture->textureIndex))
-			return Error::InvalidGltf;
-		if (material.occlusionTexture.has_value() && isInvalidTexture(material.occlusionTexture->textureIndex))
-			return Error::InvalidGltf;
-		if (material.pbrData.baseColorTexture.has_value() &&
-		    isInvalidTexture(material.pbrData.baseColorTexture->textureIndex))
-			return Error::InvalidGltf;
-		if (material.pbrData.metallicRoughnessTexture.has_value() &&
-		    isInvalidTexture(material.pbrData.metallicRoughnessTexture->textureIndex))
-			return Error::InvalidGltf;
-	}
+	auto validateCameras = [&]() -> Error {
+		for (const auto& camera : asset.cameras) {
+			if (const auto* pOrthographic = std::get_if<Camera::Orthographic>(&camera.camera)) {
+				if (pOrthographic->zfar == 0)
+					return Error::InvalidGltf;
+			} else if (const auto* pPerspective = std::get_if<Camera::Perspective>(&camera.camera)) {
+				if (pPerspective->aspectRatio.has_value() && pPerspective->aspectRatio == .0f)
+					return Error::InvalidGltf;
+				if (pPerspective->yfov == 0)
+					return Error::InvalidGltf;
+				if (pPerspective->zfar.has_value() && pPerspective->zfar == .0f)
+					return Error::InvalidGltf;
+				if (pPerspective->znear == 0.0F)
+					return Error::InvalidGltf;
+			}
+		}
+		return Error::None;
+	};
 
-	for (const auto& mesh : asset.meshes) {
-		for (const auto& primitives : mesh.primitives) {
-			for (auto [name, index] : primitives.attributes) {
-				if (asset.accessors.size() <= index)
+	auto validateImages = [&]() -> Error {
+		for (const auto& image : asset.images) {
+			if (const auto* view = std::get_if<sources::BufferView>(&image.data); view != nullptr) {
+				if (view->bufferViewIndex >= asset.bufferViews.size()) {
+					return Error::InvalidGltf;
+				}
+				// Images stored in a buffer view require a mimeType; parsing only lets this
+				// through with Options::TrustedInput.
+				if (view->mimeType == MimeType::None) {
 					return Error::InvalidGltf;
+				}
+			}
+		}
+		return Error::None;
+	};
+
+	auto validateMaterials = [&]() -> Error {
+		for (const auto& material : asset.materials) {
+			auto isInvalidTexture = [&textures = asset.textures](std::optional<std::size_t> textureIndex) {
+				return textureIndex.has_value() && textureIndex.value() >= textures.size();
+			};
+			if (material.normalTexture.has_value() && isInvalidTexture(material.normalTexture->textureIndex))
+				return Error::InvalidGltf;
+			if (material.emissiveTexture.has_value() && isInvalidTexture(material.emissiveTexture->textureIndex))
+				return Error::InvalidGltf;
+			if (material.occlusionTexture.has_value() && isInvalidTexture(material.occlusionTexture->textureIndex))
+				return Error::InvalidGltf;
+			if (material.pbrData.baseColorTexture.has_value() &&
+			    isInvalidTexture(material.pbrData.baseColorTexture->textureIndex))
+				return Error::InvalidGltf;
+			if (material.pbrData.metallicRoughnessTexture.has_value() &&
+			    isInvalidTexture(material.pbrData.metallicRoughnessTexture->textureIndex))
+				return Error::InvalidGltf;
+		}
+		return Error::None;
+	};
 
-				// The spec provides a list of attributes that it accepts and mentions that all
-				// custom attributes have to start with an underscore. We'll enforce this.
-				if (!startsWith(name, "_")) {
-					if (name != "POSITION" && name != "NORMAL" && name != "TANGENT" &&
-					    !startsWith(name, "TEXCOORD_") && !startsWith(name, "COLOR_") &&
-					    !startsWith(name, "JOINTS_") && !startsWith(name, "WEIGHTS_")) {
+	auto validateMeshes = [&]() -> Error {
+		for (const auto& mesh : asset.meshes) {
+			for (const auto& primitives : mesh.primitives) {
+				for (auto [name, index] : primitives.attributes) {
+					if (asset.accessors.size() <= index)
 						return Error::InvalidGltf;
+
+					// The spec provides a list of attributes that it accepts and mentions that all
+					// custom attributes have to start with an underscore. We'll enforce this.
+					if (!startsWith(name, "_")) {
+						if (name != "POSITION" && name != "NORMAL" && name != "TANGENT" &&
+						    !startsWith(name, "TEXCOORD_") && !startsWith(name, "COLOR_") &&
+						    !startsWith(name, "JOINTS_") && !startsWith(name, "WEIGHTS_")) {
+							return Error::InvalidGltf;
+						}
 					}
-				}
 
-				// https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
-				const auto& accessor = asset.accessors[index];
-				if (name == "POSITION") {
-					if (accessor.type != AccessorType::Vec3)
-						return Error::InvalidGltf;
-					if (!hasBit(config.extensions, Extensions::KHR_mesh_quantization)) {
-						if (accessor.componentType != ComponentType::Float)
+					// https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#meshes-overview
+					const auto& accessor = asset.accessors[index];
+					if (name == "POSITION") {
+						if (accessor.type != AccessorType::Vec3)
 							return Error::InvalidGltf;
-					} else {
-						if (accessor.componentType == ComponentType::Double || accessor.componentType == ComponentType::UnsignedInt)
+						if (!hasCompiledBit<Extensions::KHR_mesh_quantization>(config.extensions)) {
+							if (accessor.componentType != ComponentType::Float)
+								return Error::InvalidGltf;
+						} else {
+							if (accessor.componentType == ComponentType::Double || accessor.componentType == ComponentType::UnsignedInt)
+								return Error::InvalidGltf;
+						}
+					} else if (name == "NORMAL") {
+						if (accessor.type != AccessorType::Vec3)
 							return Error::InvalidGltf;
-					}
-				} else if (name == "NORMAL") {
-					if (accessor.type != AccessorType::Vec3)
-						return Error::InvalidGltf;
-					if (!hasBit(config.extensions, Extensions::KHR_mesh_quantization)) {
-						if (accessor.componentType != ComponentType::Float)
+						if (!hasCompiledBit<Extensions::KHR_mesh_quantization>(config.extensions)) {
+							if (accessor.componentType != ComponentType::Float)
+								return Error::InvalidGltf;
+						} else {
+							if (accessor.componentType != ComponentType::Float &&
+							    accessor.componentType != ComponentType::Short &&
+							    accessor.componentType != ComponentType::Byte)
+								return Error::InvalidGltf;
+						}
+					} else if (name == "TANGENT") {
+						if (accessor.type != AccessorType::Vec4)
 							return Error::InvalidGltf;
-					} else {
-						if (accessor.componentType != ComponentType::Float &&
-						    accessor.componentType != ComponentType::Short &&
-						    accessor.componentType != ComponentType::Byte)
+						if (!hasCompiledBit<Extensions::KHR_mesh_quantization>(config.extensions)) {
+							if (accessor.componentType != ComponentType::Float)
+								return Error::InvalidGltf;
+						} else {
+							if (accessor.componentType != ComponentType::Float &&
+							    accessor.componentType != ComponentType::Short &&
+							    accessor.componentType != ComponentType::Byte)
+								return Error::InvalidGltf;
+						}
+					} else if (startsWith(name, "TEXCOORD_")) {
+						if (accessor.type != AccessorType::Vec2)
 							return Error::InvalidGltf;
-					}
-				} else if (name == "TANGENT") {
-					if (accessor.type != AccessorType::Vec4)
-						return Error::InvalidGltf;
-					if (!hasBit(config.extensions, Extensions::KHR_mesh_quantization)) {
-						if (accessor.componentType != ComponentType::Float)
+						if (!hasCompiledBit<Extensions::KHR_mesh_quantization>(config.extensions)) {
+							if (accessor.componentType != ComponentType::Float &&
+							    accessor.componentType != ComponentType::UnsignedByte &&
+							    accessor.componentType != ComponentType::UnsignedShort) {
+								return Error::InvalidGltf;
+							}
+						} else {
+							if (accessor.componentType == ComponentType::Double ||
+							    accessor.componentType == ComponentType::UnsignedInt) {
+								return Error::InvalidGltf;
+							}
+						}
+					} else if (startsWith(name, "COLOR_")) {
+						if (accessor.type != AccessorType::Vec3 && accessor.type != AccessorType::Vec4)
 							return Error::InvalidGltf;
-					} else {
 						if (accessor.componentType != ComponentType::Float &&
-						    accessor.componentType != ComponentType::Short &&
-						    accessor.componentType != ComponentType::Byte)
+						    accessor.componentType != ComponentType::UnsignedByte &&
+						    accessor.componentType != ComponentType::UnsignedShort) {
+							return Error::InvalidGltf;
+						}
+					} else if (startsWith(name, "JOINTS_")) {
+						if (accessor.type != AccessorType::Vec4)
+							return Error::InvalidGltf;
+						if (accessor.componentType != ComponentType::UnsignedByte &&
+						    accessor.componentType != ComponentType::UnsignedShort) {
+							return Error::InvalidGltf;
+						}
+					} else if (startsWith(name, "WEIGHTS_")) {
+						if (accessor.type != AccessorType::Vec4)
 							return Error::InvalidGltf;
-					}
-				} else if (startsWith(name, "TEXCOORD_")) {
-					if (accessor.type != AccessorType::Vec2)
-						return Error::InvalidGltf;
-					if (!hasBit(config.extensions, Extensions::KHR_mesh_quantization)) {
 						if (accessor.componentType != ComponentType::Float &&
 						    accessor.componentType != ComponentType::UnsignedByte &&
 						    accessor.componentType != ComponentType::UnsignedShort) {
 							return Error::InvalidGltf;
 						}
-					} else {
-						if (accessor.componentType == ComponentType::Double ||
-						    accessor.componentType == ComponentType::UnsignedInt) {
+					} else if (startsWith(name, "_")) {
+						// Application-specific attribute semantics MUST start with an underscore, e.g., _TEMPERATURE.
+						// Application-specific attribute semantics MUST NOT use unsigned int component type.
+						if (accessor.componentType == ComponentType::UnsignedInt) {
 							return Error::InvalidGltf;
 						}
 					}
-				} else if (startsWith(name, "COLOR_")) {
-					if (accessor.type != AccessorType::Vec3 && accessor.type != AccessorType::Vec4)
-						return Error::InvalidGltf;
-					if (accessor.componentType != ComponentType::Float &&
-					    accessor.componentType != ComponentType::UnsignedByte &&
-					    accessor.componentType != ComponentType::UnsignedShort) {
-						return Error::InvalidGltf;
-					}
-				} else if (startsWith(name, "JOINTS_")) {
-					if (accessor.type != AccessorType::Vec4)
-						return Error::InvalidGltf;
-					if (accessor.componentType != ComponentType::UnsignedByte &&
-					    accessor.componentType != ComponentType::UnsignedShort) {
-						return Error::InvalidGltf;
-					}
-				} else if (startsWith(name, "WEIGHTS_")) {
-					if (accessor.type != AccessorType::Vec4)
-						return Error::InvalidGltf;
-					if (accessor.componentType != ComponentType::Float &&
-					    accessor.componentType != ComponentType::UnsignedByte &&
-					    accessor.componentType != ComponentType::UnsignedShort) {
-						return Error::InvalidGltf;
-					}
-				} else if (startsWith(name, "_")) {
-					// Application-specific attribute semantics MUST start with an underscore, e.g., _TEMPERATURE.
-					// Application-specific attribute semantics MUST NOT use unsigned int component type.
-					if (accessor.componentType == ComponentType::UnsignedInt) {
-						return Error::InvalidGltf;
-					}
 				}
 			}
 		}
-	}
+		return Error::None;
+	};
 
-	for (const auto& node : asset.nodes) {
-		if (node.cameraIndex.has_value() && asset.cameras.size() <= node.cameraIndex.value())
-			return Error::InvalidGltf;
-		if (node.skinIndex.has_value() && asset.skins.size() <= node.skinIndex.value())
-			return Error::InvalidGltf;
-		if (node.meshIndex.has_value() && asset.meshes.size() <= node.meshIndex.value())
-			return Error::InvalidGltf;
+	auto validateNodes = [&]() -> Error {
+		for (const auto& node : asset.nodes) {
+			if (node.cameraIndex.has_value() && asset.cameras.size() <= node.cameraIndex.value())
+				return Error::InvalidGltf;
+			if (node.skinIndex.has_value() && asset.skins.size() <= node.skinIndex.value())
+				return Error::InvalidGltf;
+			if (node.meshIndex.has_value() && asset.meshes.size() <= node.meshIndex.value())
+				return Error::InvalidGltf;
 
-		if (const auto* pTRS = std::get_if<Node::TRS>(&node.transform)) {
-			for (const auto& x : pTRS->rotation)
-				if (x > 1.0 || x < -1.0)
-					return Error::InvalidGltf;
+			if (const auto* pTRS = std::get_if<Node::TRS>(&node.transform)) {
+				for (const auto& x : pTRS->rotation)
+					if (x > 1.0 || x < -1.0)
+						return Error::InvalidGltf;
+			}
+
+			if (node.skinIndex.has_value() && node.meshIndex.has_value()) {
+				// "When the node contains skin, all mesh.primitives MUST contain JOINTS_0 and WEIGHTS_0 attributes."
+				auto& mesh = asset.meshes[node.meshIndex.value()];
+				for (auto& primitive : mesh.primitives) {
+					auto joints0 = primitive.findAttribute("JOINTS_0");
+					auto weights0 = primitive.findAttribute("WEIGHTS_0");
+					if (joints0 == primitive.attributes.end() || weights0 == primitive.attributes.end())
+						return Error::InvalidGltf;
+				}
+			}
 		}
+		return Error::None;
+	};
 
-		if (node.skinIndex.has_value() && node.meshIndex.has_value()) {
-			// "When the node contains skin, all mesh.primitives MUST contain JOINTS_0 and WEIGHTS_0 attributes."
-			auto& mesh = asset.meshes[node.meshIndex.value()];
-			for (auto& primitive : mesh.primitives) {
-				auto joints0 = primitive.findAttribute("JOINTS_0");
-				auto weights0 = primitive.findAttribute("WEIGHTS_0");
-				if (joints0 == primitive.attributes.end() || weights0 == primitive.attributes.end())
+	auto validateScenes = [&]() -> Error {
+		for (const auto& scene : asset.scenes) {
+			for (const auto& node : scene.nodeIndices) {
+				if (node >= asset.nodes.size())
 					return Error::InvalidGltf;
 			}
 		}
-	}
+		return Error::None;
+	};
 
-	for (const auto& scene : asset.scenes) {
-		for (const auto& node : scene.nodeIndices) {
-			if (node >= asset.nodes.size())
+	auto validateSkins = [&]() -> Error {
+		for (const auto& skin : asset.skins) {
+			if (skin.joints.empty())
+				return Error::InvalidGltf;
+			if (skin.skeleton.has_value() && skin.skeleton.value() >= asset.nodes.size())
+				return Error::InvalidGltf;
+			if (skin.inverseBindMatrices.has_value() && skin.inverseBindMatrices.value() >= asset.accessors.size())
 				return Error::InvalidGltf;
 		}
-	}
+		return Error::None;
+	};
 
-	for (const auto& skin : asset.skins) {
-		if (skin.joints.empty())
-			return Error::InvalidGltf;
-		if (skin.skeleton.has_value() && skin.skeleton.value() >= asset.nodes.size())
-			return Error::InvalidGltf;
-		if (skin.inverseBindMatrices.has_value() && skin.inverseBindMatrices.value() >= asset.accessors.size())
-			return Error::InvalidGltf;
+	auto validateTextures = [&]() -> Error {
+		for (const auto& texture : asset.textures) {
+			if (texture.samplerIndex.has_value() && texture.samplerIndex.value() >= asset.samplers.size())
+				return Error::InvalidGltf;
+			if (texture.imageIndex.has_value() && texture.imageIndex.value() >= asset.images.size())
+				return Error::InvalidGltf;
+			if (texture.fallbackImageIndex.has_value() && texture.fallbackImageIndex.value() >= asset.images.size())
+				return Error::InvalidGltf;
+		}
+		return Error::None;
+	};
+
+	// The categories only read from the asset and are independent of each other, so with
+	// Options::ParallelParse they get checked on multiple threads, claiming categories off a
+	// shared counter like the other parallel passes.
+	auto runCategory = [&](std::size_t index) -> Error {
+		switch (index) {
+			case 0: return validateAccessors();
+			case 1: return validateAnimations();
+			case 2: return validateBuffers();
+			case 3: return validateBufferViews();
+			case 4: return validateCameras();
+			case 5: return validateImages();
+			case 6: return validateMaterials();
+			case 7: return validateMeshes();
+			case 8: return validateNodes();
+			case 9: return validateScenes();
+			case 10: return validateSkins();
+			case 11: return validateTextures();
+			default: return Error::None;
+		}
+	};
+	constexpr std::size_t categoryCount = 12;
+
+	if (hasBit(options, Options::ParallelParse)) {
+		std::array<Error, categoryCount> results = {};
+		std::atomic<std::size_t> nextCategory(0);
+		auto worker = [&]() {
+			for (auto index = nextCategory.fetch_add(1); index < categoryCount; index = nextCategory.fetch_add(1)) {
+				results[index] = runCategory(index);
+			}
+		};
+		auto workerCount = std::min<std::size_t>(std::thread::hardware_concurrency(), categoryCount);
+		SmallVector<std::thread, 8> workers;
+		for (std::size_t i = 1; i < workerCount; ++i) {
+			workers.emplace_back(worker);
+		}
+		worker();
+		for (auto& workerThread : workers) {
+			workerThread.join();
+		}
+		for (auto error : results) {
+			if (error != Error::None)
+				return error;
+		}
+		return Error::None;
 	}
 
-	for (const auto& texture : asset.textures) {
-		if (texture.samplerIndex.has_value() && texture.samplerIndex.value() >= asset.samplers.size())
-			return Error::InvalidGltf;
-		if (texture.imageIndex.has_value() && texture.imageIndex.value() >= asset.images.size())
-			return Error::InvalidGltf;
-		if (texture.fallbackImageIndex.has_value() && texture.fallbackImageIndex.value() >= asset.images.size())
-			return Error::InvalidGltf;
+	for (std::size_t index = 0; index < categoryCount; ++index) {
+		if (auto error = runCategory(index); error != Error::None)
+			return error;
 	}
-
 	return Error::None;
 }
 
@@ -971,8 +1386,16 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 
 	Asset asset;
 
-	// Create a new chunk memory resource for each asset we parse.
-	asset.memoryResource = resourceAllocator = std::make_shared<ChunkMemoryResource>();
+	// When we're the only remaining owner of the previous arena, the asset it backed has been
+	// destroyed, and we can rewind it and reuse its warm blocks. Otherwise, create a new chunk
+	// memory resource for the asset we parse.
+	if (resourceAllocator != nullptr && resourceAllocator.use_count() == 1) {
+		resourceAllocator->reset();
+		asset.memoryResource = resourceAllocator;
+	} else {
+		asset.memoryResource = resourceAllocator = std::make_shared<ChunkMemoryResource>(
+				initialArenaSize == 0 ? ChunkMemoryResource::defaultBlockSize : initialArenaSize);
+	}
 
 	if (!hasBit(options, Options::DontRequireValidAssetMember)) {
 		dom::object assetInfo;
@@ -1035,6 +1458,35 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 	}
 
+	// With Options::ParallelParse the categories are not parsed inside the loop below, but
+	// queued up and dispatched onto worker threads afterwards. The top-level glTF arrays are
+	// independent of each other and each parse function only writes its own asset vector, so
+	// they can safely run simultaneously.
+	struct QueuedCategory {
+		Error (Parser::*function)(simdjson::dom::array&, Asset&);
+		dom::array array;
+		Category category;
+	};
+	SmallVector<QueuedCategory, 13> queuedCategories; // There are 13 category arrays in total.
+	const auto parallel = hasBit(options, Options::ParallelParse);
+
+	// Runs one category's parse function, timing it when stats are compiled in.
+	auto runCategoryParse = [&](Error (Parser::*function)(simdjson::dom::array&, Asset&),
+			dom::array& categoryArray, [[maybe_unused]] Category category) {
+#if FASTGLTF_ENABLE_STATS
+		auto begin = std::chrono::steady_clock::now();
+		auto error = (this->*function)(categoryArray, asset);
+		auto nanoseconds = elapsedNanoseconds(begin);
+		auto index = categoryIndex(category);
+		statsCollector->categoryParseNanoseconds[index].store(nanoseconds, std::memory_order_relaxed);
+		if (config.spanCallback != nullptr)
+			config.spanCallback(categorySpanNames[index], nanoseconds, config.userPointer);
+		return error;
+#else
+		return (this->*function)(categoryArray, asset);
+#endif
+	};
+
 	Category readCategories = Category::None;
 	for (const auto& object : root) {
 		// We've read everything the user asked for, we can safely exit the loop.
@@ -1073,12 +1525,19 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		}
 
 #define KEY_SWITCH_CASE(name, id) case force_consteval<crc32c(FASTGLTF_QUOTE(id))>:       \
-                if (hasBit(categories, Category::name))   \
-                    error = parse##name(array, asset);                     \
+                if (hasBit(categories, Category::name)) { \
+                    if (parallel) {                       \
+                        queuedCategories.emplace_back(QueuedCategory { &Parser::parse##name, array, Category::name }); \
+                    } else {                              \
+                        error = runCategoryParse(&Parser::parse##name, array, Category::name); \
+                        parsedCategory = Category::name;  \
+                    }                                     \
+                }                                         \
                 readCategories |= Category::name;         \
                 break;
 
 		Error error = Error::None;
+		Category parsedCategory = Category::None;
 		switch (hashedKey) {
 			KEY_SWITCH_CASE(Accessors, accessors)
 			KEY_SWITCH_CASE(Animations, animations)
@@ -1100,11 +1559,98 @@ fg::Expected<fg::Asset> fg::Parser::parse(simdjson::dom::object root, Category c
 		if (error != Error::None)
 			return Expected<Asset>(error);
 
+		// Report the completed category, so that the caller can start consuming it while the
+		// remaining categories are still being parsed.
+		if (parsedCategory != Category::None && config.categoryCallback != nullptr) {
+			config.categoryCallback(&asset, parsedCategory, config.userPointer);
+		}
+
 #undef KEY_SWITCH_CASE
 	}
 
+	if (!queuedCategories.empty()) {
+		// Each worker gets its own simdjson cursor through the array copy it holds, and only
+		// ever writes to its own category vector. The shared chunk memory resource is guarded
+		// by a mutex, so the pmr allocations the workers make are safe too.
+		SmallVector<Error, 13> errors(queuedCategories.size(), Error::None);
+		SmallVector<std::thread, 13> workers;
+		workers.reserve(queuedCategories.size());
+		for (std::size_t i = 0; i < queuedCategories.size(); ++i) {
+			workers.emplace_back([this, &asset, &queuedCategories, &errors, &runCategoryParse, i]() {
+				auto& queued = queuedCategories[i];
+				errors[i] = runCategoryParse(queued.function, queued.array, queued.category);
+				if (errors[i] == Error::None && config.categoryCallback != nullptr) {
+					config.categoryCallback(&asset, queued.category, config.userPointer);
+				}
+			});
+		}
+		for (auto& worker : workers) {
+			worker.join();
+		}
+
+		for (const auto error : errors) {
+			if (error != Error::None)
+				return Expected<Asset>(error);
+		}
+	}
+
 	asset.availableCategories = readCategories;
 
+	if (hasBit(options, Options::DecodeMeshoptCompression)) {
+#if FASTGLTF_ENABLE_MESHOPT
+		if (auto decodeError = decodeMeshoptBufferViews(asset); decodeError != Error::None)
+			return Expected<Asset>(decodeError);
+#else
+		// Without meshoptimizer compiled in, the option is only an error when there actually is
+		// something to decompress.
+		for (const auto& view : asset.bufferViews) {
+			if (view.meshoptCompression != nullptr)
+				return Expected<Asset>(Error::MissingMeshoptimizer);
+		}
+#endif
+	}
+
+	if (hasBit(options, Options::DecodeDracoCompression)) {
+#if FASTGLTF_ENABLE_DRACO
+		if (auto decodeError = decodeDracoPrimitives(asset); decodeError != Error::None)
+			return Expected<Asset>(decodeError);
+#else
+		// Without Draco compiled in, the option is only an error when there actually is
+		// something to decompress.
+		for (const auto& mesh : asset.meshes) {
+			for (const auto& primitive : mesh.primitives) {
+				if (primitive.dracoCompression != nullptr)
+					return Expected<Asset>(Error::MissingDraco);
+			}
+		}
+#endif
+	}
+
+	// This runs before the index generation on purpose, so that primitives whose attributes
+	// were sparse can be indexed afterwards like any dense primitive.
+	if (hasBit(options, Options::MaterializeSparseAccessors)) {
+		if (auto materializeError = materializeSparseAccessors(asset); materializeError != Error::None)
+			return Expected<Asset>(materializeError);
+	}
+
+	// This runs after the decompression stages on purpose, so that primitives which just had
+	// their vertex data decoded are indexed as well.
+	if (hasBit(options, Options::GenerateMeshIndices)) {
+		if (auto generateError = generateMeshIndices(asset); generateError != Error::None)
+			return Expected<Asset>(generateError);
+	}
+
+	// Join point for application-driven buffer loads: every external file has been handed to
+	// the load callback by now, so wait for the reads the application still has in flight.
+	if (config.loadCallback != nullptr && config.loadJoinCallback != nullptr) {
+		config.loadJoinCallback(config.userPointer);
+	}
+
+#if FASTGLTF_ENABLE_STATS
+	// All workers are joined by now, so reading the arena counter is safe.
+	statsCollector->arenaBytesAllocated = resourceAllocator->bytesAllocated();
+#endif
+
 	return Expected(std::move(asset));
 }
 
@@ -1245,7 +1791,8 @@ fg::Error fg::Parser::parseAccessors(simdjson::dom::array& accessors, Asset& ass
         }
 
 		// This property MUST NOT be set to true for accessors with FLOAT or UNSIGNED_INT component type.
-		if (accessor.normalized && (accessor.componentType == ComponentType::UnsignedInt || accessor.componentType == ComponentType::Float)) {
+		if (!hasBit(options, Options::TrustedInput) && accessor.normalized
+		    && (accessor.componentType == ComponentType::UnsignedInt || accessor.componentType == ComponentType::Float)) {
 			return Error::InvalidGltf;
 		}
 
@@ -1466,16 +2013,21 @@ fg::Error fg::Parser::parseBuffers(simdjson::dom::array& buffers, Asset& asset)
 
                 buffer.data = std::move(source);
             } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalBuffers)) {
-	            auto [error, source] = loadFileFromUri(uriView);
+	            auto [error, source] = loadFileFromUri(uriView, asset);
                 if (error != Error::None) {
                     return error;
                 }
 
                 buffer.data = std::move(source);
             } else {
-                sources::URI filePath;
-                filePath.fileByteOffset = 0;
-                filePath.uri = uriView;
+                // Allocate the URI string from the asset's memory resource, like names. The URI
+                // has to be move-constructed into place, as assignment would copy the string out
+                // of the resource again.
+                sources::URI filePath {
+                    0,
+                    URI(std::pmr::string(uriString, resourceAllocator.get())),
+                    MimeType::None,
+                };
                 buffer.data = std::move(filePath);
             }
         } else if (bufferIndex == 0 && !std::holds_alternative<std::monostate>(glbBuffer)) {
@@ -1553,7 +2105,7 @@ fg::Error fg::Parser::parseBufferViews(simdjson::dom::array& bufferViews, Asset&
         dom::object extensionObject;
         if (bufferViewObject["extensions"].get_object().get(extensionObject) == SUCCESS) {
             dom::object meshoptCompression;
-            if (hasBit(config.extensions, Extensions::EXT_meshopt_compression) && bufferViewObject[extensions::EXT_meshopt_compression].get_object().get(meshoptCompression) == SUCCESS) {
+            if (hasCompiledBit<Extensions::EXT_meshopt_compression>(config.extensions) && bufferViewObject[extensions::EXT_meshopt_compression].get_object().get(meshoptCompression) == SUCCESS) {
                 auto compression = std::make_unique<CompressedBufferView>();
 
                 if (auto error = bufferViewObject["buffer"].get_uint64().get(number); error != SUCCESS) {
@@ -1750,7 +2302,7 @@ fg::Error fg::Parser::parseExtensions(simdjson::dom::object& extensionsObject, A
         auto hash = crcStringFunction(extensionValue.key);
         switch (hash) {
             case force_consteval<crc32c(extensions::KHR_lights_punctual)>: {
-                if (!hasBit(config.extensions, Extensions::KHR_lights_punctual))
+                if (!hasCompiledBit<Extensions::KHR_lights_punctual>(config.extensions))
                     break;
 
                 dom::array lightsArray;
@@ -1781,7 +2333,7 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
 
         std::string_view uriString;
         if (imageObject["uri"].get_string().get(uriString) == SUCCESS) {
-            if (imageObject["bufferView"].error() == SUCCESS) {
+            if (!hasBit(options, Options::TrustedInput) && imageObject["bufferView"].error() == SUCCESS) {
                 // If uri is declared, bufferView cannot be declared.
                 return Error::InvalidGltf;
             }
@@ -1799,16 +2351,21 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
 
                 image.data = std::move(source);
             } else if (uriView.isLocalPath() && hasBit(options, Options::LoadExternalImages)) {
-	            auto [error, source] = loadFileFromUri(uriView);
+	            auto [error, source] = loadFileFromUri(uriView, asset);
                 if (error != Error::None) {
                     return error;
                 }
 
                 image.data = std::move(source);
             } else {
-                sources::URI filePath;
-                filePath.fileByteOffset = 0;
-                filePath.uri = uriView;
+                // Allocate the URI string from the asset's memory resource, like names. The URI
+                // has to be move-constructed into place, as assignment would copy the string out
+                // of the resource again.
+                sources::URI filePath {
+                    0,
+                    URI(std::pmr::string(uriString, resourceAllocator.get())),
+                    MimeType::None,
+                };
                 image.data = std::move(filePath);
             }
 
@@ -1828,14 +2385,15 @@ fg::Error fg::Parser::parseImages(simdjson::dom::array& images, Asset& asset) {
         std::uint64_t bufferViewIndex;
         if (imageObject["bufferView"].get_uint64().get(bufferViewIndex) == SUCCESS) {
             std::string_view mimeType;
-            if (imageObject["mimeType"].get_string().get(mimeType) != SUCCESS) {
+            auto mimeError = imageObject["mimeType"].get_string().get(mimeType);
+            if (mimeError != SUCCESS && !hasBit(options, Options::TrustedInput)) {
                 // If bufferView is defined, mimeType needs to also be defined.
                 return Error::InvalidGltf;
             }
 
             image.data = sources::BufferView {
                 static_cast<std::size_t>(bufferViewIndex),
-                getMimeTypeFromString(mimeType),
+                mimeError == SUCCESS ? getMimeTypeFromString(mimeType) : MimeType::None,
             };
         }
 
@@ -1959,7 +2517,9 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
 
         dom::array emissiveFactor;
         if (materialObject["emissiveFactor"].get_array().get(emissiveFactor) == SUCCESS) {
-            if (emissiveFactor.size() != 3) {
+            // The extraction below reads exactly three components either way, so this check is
+            // only about spec conformance and can be skipped for trusted input.
+            if (!hasBit(options, Options::TrustedInput) && emissiveFactor.size() != 3) {
                 return Error::InvalidGltf;
             }
             for (auto i = 0U; i < 3; ++i) {
@@ -2067,7 +2627,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
         material.unlit = false;
         dom::object extensionsObject;
         if (auto extensionError = materialObject["extensions"].get_object().get(extensionsObject); extensionError == SUCCESS) {
-            if (hasBit(config.extensions, Extensions::KHR_materials_clearcoat)) {
+            if (hasCompiledBit<Extensions::KHR_materials_clearcoat>(config.extensions)) {
                 dom::object clearcoatObject;
                 auto clearcoatError = extensionsObject[extensions::KHR_materials_clearcoat].get_object().get(clearcoatObject);
                 if (clearcoatError == SUCCESS) {
@@ -2118,7 +2678,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_emissive_strength)) {
+            if (hasCompiledBit<Extensions::KHR_materials_emissive_strength>(config.extensions)) {
                 dom::object emissiveObject;
                 auto emissiveError = extensionsObject[extensions::KHR_materials_emissive_strength].get_object().get(emissiveObject);
                 if (emissiveError == SUCCESS) {
@@ -2134,7 +2694,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_ior)) {
+            if (hasCompiledBit<Extensions::KHR_materials_ior>(config.extensions)) {
                 dom::object iorObject;
                 auto iorError = extensionsObject[extensions::KHR_materials_ior].get_object().get(iorObject);
                 if (iorError == SUCCESS) {
@@ -2152,7 +2712,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_iridescence)) {
+            if (hasCompiledBit<Extensions::KHR_materials_iridescence>(config.extensions)) {
                 dom::object iridescenceObject;
                 auto iridescenceError = extensionsObject[extensions::KHR_materials_iridescence].get_object().get(iridescenceObject);
                 if (iridescenceError == SUCCESS) {
@@ -2214,7 +2774,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_sheen)) {
+            if (hasCompiledBit<Extensions::KHR_materials_sheen>(config.extensions)) {
                 dom::object sheenObject;
                 auto sheenError = extensionsObject[extensions::KHR_materials_sheen].get_object().get(sheenObject);
                 if (sheenError == SUCCESS) {
@@ -2268,7 +2828,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_specular)) {
+            if (hasCompiledBit<Extensions::KHR_materials_specular>(config.extensions)) {
                 dom::object specularObject;
                 auto specularError = extensionsObject[extensions::KHR_materials_specular].get_object().get(specularObject);
                 if (specularError == SUCCESS) {
@@ -2322,7 +2882,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_transmission)) {
+            if (hasCompiledBit<Extensions::KHR_materials_transmission>(config.extensions)) {
                 dom::object transmissionObject;
                 auto transmissionError = extensionsObject[extensions::KHR_materials_transmission].get_object().get(transmissionObject);
                 if (transmissionError == SUCCESS) {
@@ -2350,7 +2910,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_unlit)) {
+            if (hasCompiledBit<Extensions::KHR_materials_unlit>(config.extensions)) {
                 dom::object unlitObject;
                 auto unlitError = extensionsObject[extensions::KHR_materials_unlit].get_object().get(unlitObject);
                 if (unlitError == SUCCESS) {
@@ -2360,7 +2920,7 @@ fg::Error fg::Parser::parseMaterials(simdjson::dom::array& materials, Asset& ass
                 }
             }
 
-            if (hasBit(config.extensions, Extensions::KHR_materials_volume)) {
+            if (hasCompiledBit<Extensions::KHR_materials_volume>(config.extensions)) {
                 dom::object volumeObject;
                 auto volumeError = extensionsObject[extensions::KHR_materials_volume].get_object().get(volumeObject);
                 if (volumeError == SUCCESS) {
@@ -2507,6 +3067,30 @@ fg::Error fg::Parser::parseMeshes(simdjson::dom::array& meshes, Asset& asset) {
                     primitive.materialIndex = static_cast<std::size_t>(value);
                 }
 
+                dom::object extensionsObject;
+                if (hasCompiledBit<Extensions::KHR_draco_mesh_compression>(config.extensions)
+                        && primitiveObject["extensions"].get_object().get(extensionsObject) == SUCCESS) {
+                    dom::object dracoObject;
+                    if (extensionsObject[extensions::KHR_draco_mesh_compression].get_object().get(dracoObject) == SUCCESS) {
+                        // Required fields: "bufferView", "attributes"
+                        std::uint64_t bufferView;
+                        if (dracoObject["bufferView"].get_uint64().get(bufferView) != SUCCESS) {
+                            return Error::InvalidGltf;
+                        }
+
+                        dom::object dracoAttributes;
+                        if (dracoObject["attributes"].get_object().get(dracoAttributes) != SUCCESS) {
+                            return Error::InvalidGltf;
+                        }
+
+                        primitive.dracoCompression = std::make_unique<DracoCompressedPrimitive>();
+                        primitive.dracoCompression->bufferViewIndex = static_cast<std::size_t>(bufferView);
+                        if (auto attributeError = parseAttributes(dracoAttributes, primitive.dracoCompression->attributes); attributeError != Error::None) {
+                            return attributeError;
+                        }
+                    }
+                }
+
                 mesh.primitives.emplace_back(std::move(primitive));
             }
         }
@@ -2948,6 +3532,209 @@ std::size_t fg::GltfDataBuffer::getBufferSize() const noexcept {
 }
 #pragma endregion
 
+#pragma region MappedGltfDataBuffer
+fg::MappedGltfDataBuffer::~MappedGltfDataBuffer() noexcept {
+    unmap();
+}
+
+void fg::MappedGltfDataBuffer::unmap() noexcept {
+#if defined(_WIN32)
+    if (mapPointer != nullptr) {
+        UnmapViewOfFile(mapPointer);
+        mapPointer = nullptr;
+    }
+    if (fileMapping != nullptr) {
+        CloseHandle(fileMapping);
+        fileMapping = nullptr;
+    }
+    if (fileHandle != nullptr) {
+        CloseHandle(fileHandle);
+        fileHandle = nullptr;
+    }
+#else
+    if (mapPointer != nullptr) {
+        munmap(mapPointer, mapLength);
+        mapPointer = nullptr;
+    }
+    if (fileDescriptor >= 0) {
+        close(fileDescriptor);
+        fileDescriptor = -1;
+    }
+#endif
+    mapLength = 0;
+}
+
+bool fg::MappedGltfDataBuffer::mapFromFile(const fs::path& path, std::uint64_t byteOffset) noexcept {
+    unmap();
+    buffer.reset();
+
+    std::error_code ec;
+    auto length = static_cast<std::uint64_t>(std::filesystem::file_size(path, ec));
+    if (ec || byteOffset >= length) {
+        return false;
+    }
+
+#if defined(_WIN32)
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    const auto pageSize = static_cast<std::int64_t>(systemInfo.dwPageSize);
+    // View offsets have to be multiples of the allocation granularity, which is usually larger
+    // than the page size.
+    const auto offsetAlignment = static_cast<std::int64_t>(systemInfo.dwAllocationGranularity);
+#else
+    const auto pageSize = static_cast<std::int64_t>(sysconf(_SC_PAGESIZE));
+    const auto offsetAlignment = pageSize;
+#endif
+
+    // The bytes between the end of the file and the end of the last mapped page are readable
+    // and zeroed, which is exactly what the simdjson padding requires. If the file ends too
+    // close to a page boundary there is no such guarantee, so copy the file contents instead.
+    const auto mappedEnd = static_cast<std::uint64_t>(alignUp(static_cast<std::int64_t>(length), pageSize));
+    if (mappedEnd - length < getGltfBufferPadding()) {
+        return loadFromFile(path, byteOffset);
+    }
+
+    // The mapping offset needs to be aligned, so map from the closest aligned offset below the
+    // requested one and point past the excess bytes.
+    const auto alignedOffset = static_cast<std::uint64_t>(alignDown(static_cast<std::int64_t>(byteOffset), offsetAlignment));
+
+#if defined(_WIN32)
+    fileHandle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        fileHandle = nullptr;
+        return false;
+    }
+
+    fileMapping = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (fileMapping == nullptr) {
+        unmap();
+        return loadFromFile(path, byteOffset);
+    }
+
+    mapLength = static_cast<std::size_t>(length - alignedOffset);
+    mapPointer = MapViewOfFile(fileMapping, FILE_MAP_READ,
+                               static_cast<DWORD>(alignedOffset >> 32),
+                               static_cast<DWORD>(alignedOffset & 0xffffffff), 0);
+    if (mapPointer == nullptr) {
+        unmap();
+        return loadFromFile(path, byteOffset);
+    }
+#else
+    fileDescriptor = open(path.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        fileDescriptor = -1;
+        return false;
+    }
+
+    mapLength = static_cast<std::size_t>(length - alignedOffset);
+    mapPointer = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fileDescriptor, static_cast<off_t>(alignedOffset));
+    if (mapPointer == MAP_FAILED) {
+        mapPointer = nullptr;
+        unmap();
+        return loadFromFile(path, byteOffset);
+    }
+#endif
+
+    bufferPointer = static_cast<std::byte*>(mapPointer) + (byteOffset - alignedOffset);
+    dataSize = length - byteOffset;
+    allocatedSize = mappedEnd - byteOffset;
+    filePath = path;
+    return true;
+}
+#pragma endregion
+
+#pragma region GlbStream
+fg::Error fg::GlbStream::feedBytes(const std::uint8_t* bytes, std::size_t byteCount) {
+    // Accumulates header bytes in the pending buffer until headerSize bytes are available, and
+    // returns whether the header is complete.
+    auto readHeader = [this, &bytes, &byteCount](void* dst, std::size_t headerSize) {
+        auto take = (std::min)(headerSize - pendingBytes, byteCount);
+        std::memcpy(pending.data() + pendingBytes, bytes, take);
+        pendingBytes += take;
+        consumedBytes += take;
+        bytes += take;
+        byteCount -= take;
+        if (pendingBytes < headerSize)
+            return false;
+        std::memcpy(dst, pending.data(), headerSize);
+        pendingBytes = 0;
+        return true;
+    };
+
+    while (byteCount > 0) {
+        switch (stage) {
+            case Stage::Header: {
+                BinaryGltfHeader header = {};
+                if (!readHeader(&header, sizeof header))
+                    return Error::None;
+                if (header.magic != binaryGltfHeaderMagic || header.version != 2)
+                    return Error::InvalidGLB;
+                totalLength = header.length;
+                stage = Stage::JsonChunkHeader;
+                break;
+            }
+            case Stage::JsonChunkHeader: {
+                BinaryGltfChunk chunk = {};
+                if (!readHeader(&chunk, sizeof chunk))
+                    return Error::None;
+                if (chunk.chunkType != binaryGltfJsonChunkMagic)
+                    return Error::InvalidGLB;
+                jsonLength = chunk.chunkLength;
+                if (jsonLength == 0 || consumedBytes + jsonLength > totalLength)
+                    return Error::InvalidGLB;
+                // The padding lets the JSON chunk be handed to simdjson without another copy.
+                jsonBytes.resize(jsonLength + simdjson::SIMDJSON_PADDING);
+                stage = Stage::JsonChunk;
+                break;
+            }
+            case Stage::JsonChunk: {
+                auto take = (std::min)(jsonLength - jsonBytesRead, byteCount);
+                std::memcpy(jsonBytes.data() + jsonBytesRead, bytes, take);
+                jsonBytesRead += take;
+                consumedBytes += take;
+                bytes += take;
+                byteCount -= take;
+                if (jsonBytesRead == jsonLength)
+                    stage = totalLength > consumedBytes + sizeof(BinaryGltfChunk) ? Stage::BinaryChunkHeader : Stage::Complete;
+                break;
+            }
+            case Stage::BinaryChunkHeader: {
+                BinaryGltfChunk chunk = {};
+                if (!readHeader(&chunk, sizeof chunk))
+                    return Error::None;
+                if (chunk.chunkType != binaryGltfDataChunkMagic)
+                    return Error::InvalidGLB;
+                binaryLength = chunk.chunkLength;
+                if (consumedBytes + binaryLength > totalLength)
+                    return Error::InvalidGLB;
+                // The storage is allocated to its final size upfront, so that views handed out
+                // by canStartParse-time parsing stay valid while the remaining bytes land.
+                binaryBytes.resize(binaryLength);
+                stage = binaryLength > 0 ? Stage::BinaryChunk : Stage::Complete;
+                break;
+            }
+            case Stage::BinaryChunk: {
+                auto take = (std::min)(binaryLength - binaryBytesRead, byteCount);
+                std::memcpy(binaryBytes.data() + binaryBytesRead, bytes, take);
+                binaryBytesRead += take;
+                consumedBytes += take;
+                bytes += take;
+                byteCount -= take;
+                if (binaryBytesRead == binaryLength)
+                    stage = Stage::Complete;
+                break;
+            }
+            case Stage::Complete: {
+                // Bytes past the advertised file length cannot belong to this GLB.
+                return Error::InvalidGLB;
+            }
+        }
+    }
+    return Error::None;
+}
+#pragma endregion
+
 #pragma region AndroidGltfDataBuffer
 #if defined(__ANDROID__)
 fg::AndroidGltfDataBuffer::AndroidGltfDataBuffer(AAssetManager* assetManager) noexcept : assetManager{assetManager} {}
@@ -3016,17 +3803,721 @@ fastgltf::GltfType fg::determineGltfFileType(GltfDataBuffer* buffer) {
     return GltfType::Invalid;
 }
 
-fg::Parser::Parser(Extensions extensionsToLoad) noexcept {
+#if FASTGLTF_ENABLE_DRACO
+fg::Error fg::Parser::decodeDracoPrimitives(Asset& asset) const {
+	// Collect the compressed primitives upfront, so that independent primitives can be decoded
+	// in parallel. The decoded bytes are only appended to the asset after all jobs have joined,
+	// as the buffers and bufferViews vectors must not be mutated concurrently.
+	SmallVector<Primitive*, 8> compressedPrimitives;
+	for (auto& mesh : asset.meshes) {
+		for (auto& primitive : mesh.primitives) {
+			if (primitive.dracoCompression != nullptr)
+				compressedPrimitives.emplace_back(&primitive);
+		}
+	}
+
+	if (compressedPrimitives.empty())
+		return Error::None;
+
+	struct DecodedAccessorData {
+		std::size_t accessorIndex;
+		std::size_t count;
+		std::vector<std::uint8_t> bytes;
+	};
+
+	std::vector<SmallVector<DecodedAccessorData, 4>> results(compressedPrimitives.size());
+	SmallVector<Error, 8> errors(compressedPrimitives.size(), Error::None);
+
+	auto decodePrimitive = [&](std::size_t job) {
+		auto& primitive = *compressedPrimitives[job];
+		const auto& compression = *primitive.dracoCompression;
+
+		if (compression.bufferViewIndex >= asset.bufferViews.size()) {
+			errors[job] = Error::InvalidGltf;
+			return;
+		}
+		const auto& view = asset.bufferViews[compression.bufferViewIndex];
+
+		const std::byte* sourceBytes = std::visit(visitor {
+			[](const auto&) -> const std::byte* {
+				return nullptr;
+			},
+			[](const sources::Vector& vec) {
+				return reinterpret_cast<const std::byte*>(vec.bytes.data());
+			},
+			[](const sources::ByteView& bv) {
+				return bv.bytes.data();
+			},
+		}, asset.buffers[view.bufferIndex].data);
+
+		if (sourceBytes == nullptr) {
+			// The compressed bytes are not in memory, e.g. because external buffers weren't loaded.
+			errors[job] = Error::MissingExternalBuffer;
+			return;
+		}
+		sourceBytes += view.byteOffset;
+
+		draco::DecoderBuffer decoderBuffer;
+		decoderBuffer.Init(reinterpret_cast<const char*>(sourceBytes), view.byteLength);
+
+		draco::Decoder decoder;
+		auto decodeResult = decoder.DecodeMeshFromBuffer(&decoderBuffer);
+		if (!decodeResult.ok()) {
+			errors[job] = Error::InvalidGltf;
+			return;
+		}
+		const auto decodedMesh = std::move(decodeResult).value();
+
+		// The indices come out of Draco as 32-bit values, but have to be stored with the
+		// component type the accessor declares for the decompressed data.
+		if (primitive.indicesAccessor.has_value()) {
+			auto& accessor = asset.accessors[*primitive.indicesAccessor];
+			const auto indexCount = static_cast<std::size_t>(decodedMesh->num_faces()) * 3;
+			const auto indexSize = getElementByteSize(AccessorType::Scalar, accessor.componentType);
+
+			DecodedAccessorData indices = {};
+			indices.accessorIndex = *primitive.indicesAccessor;
+			indices.count = indexCount;
+			indices.bytes.resize(indexCount * indexSize);
+			for (draco::FaceIndex f(0); f < decodedMesh->num_faces(); ++f) {
+				const auto& face = decodedMesh->face(f);
+				for (std::size_t corner = 0; corner < 3; ++corner) {
+					const auto value = face[corner].value();
+					auto* dst = indices.bytes.data() + (static_cast<std::size_t>(f.value()) * 3 + corner) * indexSize;
+					switch (accessor.componentType) {
+						case ComponentType::UnsignedByte: {
+							auto index = static_cast<std::uint8_t>(value);
+							std::memcpy(dst, &index, sizeof index);
+							break;
+						}
+						case ComponentType::UnsignedShort: {
+							auto index = static_cast<std::uint16_t>(value);
+							std::memcpy(dst, &index, sizeof index);
+							break;
+						}
+						case ComponentType::UnsignedInt: {
+							auto index = static_cast<std::uint32_t>(value);
+							std::memcpy(dst, &index, sizeof index);
+							break;
+						}
+						default:
+							errors[job] = Error::InvalidGltf;
+							return;
+					}
+				}
+			}
+			results[job].emplace_back(std::move(indices));
+		}
+
+		for (const auto& [name, uniqueId] : compression.attributes) {
+			const auto* attribute = decodedMesh->GetAttributeByUniqueId(static_cast<std::uint32_t>(uniqueId));
+			if (attribute == nullptr) {
+				errors[job] = Error::InvalidGltf;
+				return;
+			}
+
+			// Find the accessor the attribute of the same name points at.
+			const Primitive::attribute_type* primitiveAttribute = nullptr;
+			for (const auto& pair : primitive.attributes) {
+				if (pair.first == name) {
+					primitiveAttribute = &pair;
+					break;
+				}
+			}
+			if (primitiveAttribute == nullptr) {
+				errors[job] = Error::InvalidGltf;
+				return;
+			}
+
+			const auto pointCount = static_cast<std::size_t>(decodedMesh->num_points());
+			const auto valueSize = static_cast<std::size_t>(attribute->byte_stride());
+
+			DecodedAccessorData values = {};
+			values.accessorIndex = primitiveAttribute->second;
+			values.count = pointCount;
+			values.bytes.resize(pointCount * valueSize);
+			for (draco::PointIndex p(0); p < decodedMesh->num_points(); ++p) {
+				attribute->GetMappedValue(p, values.bytes.data() + static_cast<std::size_t>(p.value()) * valueSize);
+			}
+			results[job].emplace_back(std::move(values));
+		}
+	};
+
+	if (hasBit(options, Options::ParallelParse) && compressedPrimitives.size() > 1) {
+		SmallVector<std::thread, 8> workers;
+		workers.reserve(compressedPrimitives.size());
+		for (std::size_t i = 0; i < compressedPrimitives.size(); ++i)
+			workers.emplace_back(decodePrimitive, i);
+		for (auto& worker : workers)
+			worker.join();
+	} else {
+		for (std::size_t i = 0; i < compressedPrimitives.size(); ++i)
+			decodePrimitive(i);
+	}
+
+	for (const auto error : errors) {
+		if (error != Error::None)
+			return error;
+	}
+
+	// Append the decoded data and point the accessors at it, so the asset looks like it was
+	// never compressed.
+	for (std::size_t job = 0; job < results.size(); ++job) {
+		for (auto& decoded : results[job]) {
+			sources::Vector decodedSource = {};
+			decodedSource.mimeType = MimeType::GltfBuffer;
+			decodedSource.bytes = std::move(decoded.bytes);
+
+			auto& buffer = asset.buffers.emplace_back();
+			buffer.byteLength = decodedSource.bytes.size();
+
+			auto& view = asset.bufferViews.emplace_back();
+			view.bufferIndex = asset.buffers.size() - 1;
+			view.byteOffset = 0;
+			view.byteLength = decodedSource.bytes.size();
+			buffer.data = std::move(decodedSource);
+
+			auto& accessor = asset.accessors[decoded.accessorIndex];
+			accessor.bufferViewIndex = asset.bufferViews.size() - 1;
+			accessor.byteOffset = 0;
+			accessor.count = decoded.count;
+		}
+		compressedPrimitives[job]->dracoCompression.reset();
+	}
+	return Error::None;
+}
+#endif
+
+#if FASTGLTF_ENABLE_MESHOPT
+fg::Error fg::Parser::decodeMeshoptBufferViews(Asset& asset) const {
+	// Collect the compressed views upfront, so that the decode jobs can run in parallel without
+	// mutating the bufferViews and buffers vectors concurrently.
+	SmallVector<std::size_t, 8> compressedViews;
+	for (std::size_t i = 0; i < asset.bufferViews.size(); ++i) {
+		if (asset.bufferViews[i].meshoptCompression != nullptr)
+			compressedViews.emplace_back(i);
+	}
+
+	if (compressedViews.empty())
+		return Error::None;
+
+	// Each compressed view gets decoded into its own new buffer, appended serially here so the
+	// jobs below only ever touch their own buffer and view.
+	const auto firstDecodedBuffer = asset.buffers.size();
+	for (const auto viewIndex : compressedViews) {
+		const auto& compression = *asset.bufferViews[viewIndex].meshoptCompression;
+		sources::Vector decoded = {};
+		decoded.mimeType = MimeType::GltfBuffer;
+		decoded.bytes.resize(compression.count * compression.byteStride);
+
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = decoded.bytes.size();
+		buffer.data = std::move(decoded);
+	}
+
+	SmallVector<Error, 8> errors(compressedViews.size(), Error::None);
+	auto decodeView = [&](std::size_t job) {
+		auto& view = asset.bufferViews[compressedViews[job]];
+		const auto& compression = *view.meshoptCompression;
+
+		const std::byte* sourceBytes = std::visit(visitor {
+			[](const auto&) -> const std::byte* {
+				return nullptr;
+			},
+			[](const sources::Vector& vec) {
+				return reinterpret_cast<const std::byte*>(vec.bytes.data());
+			},
+			[](const sources::ByteView& bv) {
+				return bv.bytes.data();
+			},
+		}, asset.buffers[compression.bufferIndex].data);
+
+		if (sourceBytes == nullptr) {
+			// The compressed bytes are not in memory, e.g. because external buffers weren't loaded.
+			errors[job] = Error::MissingExternalBuffer;
+			return;
+		}
+		sourceBytes += compression.byteOffset;
+
+		auto& decoded = std::get<sources::Vector>(asset.buffers[firstDecodedBuffer + job].data);
+		int result;
+		switch (compression.mode) {
+			case MeshoptCompressionMode::Attributes:
+				result = meshopt_decodeVertexBuffer(decoded.bytes.data(), compression.count, compression.byteStride,
+						reinterpret_cast<const unsigned char*>(sourceBytes), compression.byteLength);
+				break;
+			case MeshoptCompressionMode::Triangles:
+			case MeshoptCompressionMode::Indices: {
+				const auto decode = compression.mode == MeshoptCompressionMode::Triangles
+						? meshopt_decodeIndexBuffer : meshopt_decodeIndexSequence;
+				result = decode(decoded.bytes.data(), compression.count, compression.byteStride,
+						reinterpret_cast<const unsigned char*>(sourceBytes), compression.byteLength);
+				break;
+			}
+			default:
+				errors[job] = Error::InvalidGltf;
+				return;
+		}
+
+		if (result != 0) {
+			errors[job] = Error::InvalidGltf;
+			return;
+		}
+
+		switch (compression.filter) {
+			case MeshoptCompressionFilter::Octahedral:
+				meshopt_decodeFilterOct(decoded.bytes.data(), compression.count, compression.byteStride);
+				break;
+			case MeshoptCompressionFilter::Quaternion:
+				meshopt_decodeFilterQuat(decoded.bytes.data(), compression.count, compression.byteStride);
+				break;
+			case MeshoptCompressionFilter::Exponential:
+				meshopt_decodeFilterExp(decoded.bytes.data(), compression.count, compression.byteStride);
+				break;
+			default:
+				break;
+		}
+
+		// Point the view at the decoded bytes, so the asset looks like it was never compressed.
+		view.bufferIndex = firstDecodedBuffer + job;
+		view.byteOffset = 0;
+		view.byteLength = decoded.bytes.size();
+		view.byteStride = compression.byteStride;
+		view.meshoptCompression.reset();
+	};
+
+	if (hasBit(options, Options::ParallelParse) && compressedViews.size() > 1) {
+		SmallVector<std::thread, 8> workers;
+		workers.reserve(compressedViews.size());
+		for (std::size_t i = 0; i < compressedViews.size(); ++i)
+			workers.emplace_back(decodeView, i);
+		for (auto& worker : workers)
+			worker.join();
+	} else {
+		for (std::size_t i = 0; i < compressedViews.size(); ++i)
+			decodeView(i);
+	}
+
+	for (const auto error : errors) {
+		if (error != Error::None)
+			return error;
+	}
+	return Error::None;
+}
+#endif
+
+fg::Error fg::Parser::generateMeshIndices(Asset& asset) const {
+	// Collect the non-indexed primitives upfront, so that independent primitives can be
+	// processed in parallel. The generated data is only appended to the asset after all jobs
+	// have joined, as the buffers, bufferViews, and accessors vectors must not be mutated
+	// concurrently.
+	SmallVector<Primitive*, 8> unindexedPrimitives;
+	for (auto& mesh : asset.meshes) {
+		for (auto& primitive : mesh.primitives) {
+			if (!primitive.indicesAccessor.has_value() && !primitive.attributes.empty())
+				unindexedPrimitives.emplace_back(&primitive);
+		}
+	}
+
+	if (unindexedPrimitives.empty())
+		return Error::None;
+
+	struct GeneratedIndexData {
+		// Zero when the primitive had to be skipped, e.g. because an attribute is sparse.
+		std::size_t indexCount = 0;
+		std::size_t uniqueCount = 0;
+		ComponentType indexType = ComponentType::Invalid;
+		std::vector<std::uint8_t> indexBytes;
+
+		// Compacted vertex data per attribute, in the order of Primitive::attributes. Only
+		// filled when the primitive actually contained duplicate vertices.
+		std::vector<std::vector<std::uint8_t>> attributeBytes;
+	};
+
+	std::vector<GeneratedIndexData> results(unindexedPrimitives.size());
+	SmallVector<Error, 8> errors(unindexedPrimitives.size(), Error::None);
+
+	auto generateIndices = [&](std::size_t job) {
+		auto& primitive = *unindexedPrimitives[job];
+		auto& result = results[job];
+
+		struct AttributeSource {
+			const std::byte* data;
+			std::size_t stride;
+			std::size_t elementSize;
+		};
+		SmallVector<AttributeSource, 4> attributeSources;
+		attributeSources.reserve(primitive.attributes.size());
+
+		std::size_t vertexCount = 0;
+		for (const auto& [name, accessorIndex] : primitive.attributes) {
+			if (accessorIndex >= asset.accessors.size()) {
+				errors[job] = Error::InvalidGltf;
+				return;
+			}
+			const auto& accessor = asset.accessors[accessorIndex];
+
+			// Sparse attributes and attributes without backing data would have to be expanded
+			// before they could be deduplicated, so such primitives are left untouched.
+			if (accessor.sparse.has_value() || !accessor.bufferViewIndex.has_value())
+				return;
+
+			if (attributeSources.empty()) {
+				vertexCount = accessor.count;
+			} else if (accessor.count != vertexCount) {
+				errors[job] = Error::InvalidGltf;
+				return;
+			}
+
+			const auto& view = asset.bufferViews[*accessor.bufferViewIndex];
+			const std::byte* sourceBytes = std::visit(visitor {
+				[](const auto&) -> const std::byte* {
+					return nullptr;
+				},
+				[](const sources::Vector& vec) {
+					return reinterpret_cast<const std::byte*>(vec.bytes.data());
+				},
+				[](const sources::ByteView& bv) {
+					return bv.bytes.data();
+				},
+			}, asset.buffers[view.bufferIndex].data);
+
+			if (sourceBytes == nullptr) {
+				// The vertex bytes are not in memory, e.g. because external buffers weren't loaded.
+				errors[job] = Error::MissingExternalBuffer;
+				return;
+			}
+
+			auto elementSize = static_cast<std::size_t>(getElementByteSize(accessor.type, accessor.componentType));
+			AttributeSource source = {};
+			source.data = sourceBytes + view.byteOffset + accessor.byteOffset;
+			source.stride = view.byteStride.value_or(elementSize);
+			source.elementSize = elementSize;
+			attributeSources.emplace_back(source);
+		}
+
+		if (vertexCount == 0)
+			return;
+
+		// Morph target accessors index into the same vertex order, so reordering the vertices
+		// of a primitive with targets would invalidate them. Those primitives only get a
+		// trivial index buffer.
+		auto deduplicate = primitive.targets.empty();
+
+		std::size_t packedVertexSize = 0;
+		for (const auto& source : attributeSources)
+			packedVertexSize += source.elementSize;
+
+		// Maps the packed bytes of a vertex to its index in the deduplicated vertex stream.
+		std::vector<std::uint32_t> remap(vertexCount);
+		std::vector<std::uint32_t> uniqueVertices;
+		std::size_t uniqueCount = vertexCount;
+		if (deduplicate) {
+			std::unordered_map<std::string, std::uint32_t> vertexMap;
+			vertexMap.reserve(vertexCount);
+			uniqueVertices.reserve(vertexCount);
+			std::string packedVertex(packedVertexSize, '\0');
+			for (std::size_t i = 0; i < vertexCount; ++i) {
+				std::size_t offset = 0;
+				for (const auto& source : attributeSources) {
+					std::memcpy(packedVertex.data() + offset, source.data + i * source.stride, source.elementSize);
+					offset += source.elementSize;
+				}
+
+				auto [it, inserted] = vertexMap.try_emplace(packedVertex, static_cast<std::uint32_t>(uniqueVertices.size()));
+				if (inserted)
+					uniqueVertices.emplace_back(static_cast<std::uint32_t>(i));
+				remap[i] = it->second;
+			}
+			uniqueCount = uniqueVertices.size();
+		} else {
+			for (std::size_t i = 0; i < vertexCount; ++i)
+				remap[i] = static_cast<std::uint32_t>(i);
+		}
+
+		result.indexCount = vertexCount;
+		result.uniqueCount = uniqueCount;
+		result.indexType = uniqueCount <= std::numeric_limits<std::uint16_t>::max()
+			? ComponentType::UnsignedShort : ComponentType::UnsignedInt;
+
+		auto indexSize = static_cast<std::size_t>(getComponentBitSize(result.indexType)) / 8;
+		result.indexBytes.resize(vertexCount * indexSize);
+		for (std::size_t i = 0; i < vertexCount; ++i) {
+			if (result.indexType == ComponentType::UnsignedShort) {
+				auto index = static_cast<std::uint16_t>(remap[i]);
+				std::memcpy(result.indexBytes.data() + i * indexSize, &index, sizeof index);
+			} else {
+				std::memcpy(result.indexBytes.data() + i * indexSize, &remap[i], sizeof remap[i]);
+			}
+		}
+
+		// Only rewrite the vertex streams when deduplication actually shrank them.
+		if (uniqueCount < vertexCount) {
+			result.attributeBytes.resize(attributeSources.size());
+			for (std::size_t a = 0; a < attributeSources.size(); ++a) {
+				const auto& source = attributeSources[a];
+				auto& bytes = result.attributeBytes[a];
+				bytes.resize(uniqueCount * source.elementSize);
+				for (std::size_t i = 0; i < uniqueCount; ++i) {
+					std::memcpy(bytes.data() + i * source.elementSize,
+						source.data + static_cast<std::size_t>(uniqueVertices[i]) * source.stride, source.elementSize);
+				}
+			}
+		}
+	};
+
+	if (hasBit(options, Options::ParallelParse) && unindexedPrimitives.size() > 1) {
+		SmallVector<std::thread, 8> workers;
+		workers.reserve(unindexedPrimitives.size());
+		for (std::size_t i = 0; i < unindexedPrimitives.size(); ++i)
+			workers.emplace_back(generateIndices, i);
+		for (auto& worker : workers)
+			worker.join();
+	} else {
+		for (std::size_t i = 0; i < unindexedPrimitives.size(); ++i)
+			generateIndices(i);
+	}
+
+	for (const auto error : errors) {
+		if (error != Error::None)
+			return error;
+	}
+
+	// Append the generated data. Each byte vector becomes its own buffer and buffer view, like
+	// the decompression stages do it.
+	auto appendDataBuffer = [&asset](std::vector<std::uint8_t>&& bytes) {
+		sources::Vector generatedSource = {};
+		generatedSource.mimeType = MimeType::GltfBuffer;
+		generatedSource.bytes = std::move(bytes);
+
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = generatedSource.bytes.size();
+
+		auto& view = asset.bufferViews.emplace_back();
+		view.bufferIndex = asset.buffers.size() - 1;
+		view.byteOffset = 0;
+		view.byteLength = generatedSource.bytes.size();
+		buffer.data = std::move(generatedSource);
+		return asset.bufferViews.size() - 1;
+	};
+
+	for (std::size_t job = 0; job < results.size(); ++job) {
+		auto& result = results[job];
+		if (result.indexCount == 0)
+			continue;
+		auto& primitive = *unindexedPrimitives[job];
+
+		Accessor indexAccessor = {};
+		indexAccessor.bufferViewIndex = appendDataBuffer(std::move(result.indexBytes));
+		indexAccessor.byteOffset = 0;
+		indexAccessor.count = result.indexCount;
+		indexAccessor.type = AccessorType::Scalar;
+		indexAccessor.componentType = result.indexType;
+		indexAccessor.normalized = false;
+		asset.accessors.emplace_back(std::move(indexAccessor));
+		primitive.indicesAccessor = asset.accessors.size() - 1;
+
+		for (std::size_t a = 0; a < result.attributeBytes.size(); ++a) {
+			auto& attribute = primitive.attributes[a];
+
+			// The source accessor might be shared with other primitives, so the compacted
+			// stream gets a new accessor instead of rewriting it in place. The element bounds
+			// stay valid, as deduplication removes no unique values.
+			Accessor vertexAccessor = {};
+			{
+				const auto& oldAccessor = asset.accessors[attribute.second];
+				vertexAccessor.byteOffset = 0;
+				vertexAccessor.count = result.uniqueCount;
+				vertexAccessor.type = oldAccessor.type;
+				vertexAccessor.componentType = oldAccessor.componentType;
+				vertexAccessor.normalized = oldAccessor.normalized;
+				vertexAccessor.max = oldAccessor.max;
+				vertexAccessor.min = oldAccessor.min;
+			}
+			vertexAccessor.bufferViewIndex = appendDataBuffer(std::move(result.attributeBytes[a]));
+			asset.accessors.emplace_back(std::move(vertexAccessor));
+			attribute.second = asset.accessors.size() - 1;
+		}
+	}
+	return Error::None;
+}
+
+fg::Error fg::Parser::materializeSparseAccessors(Asset& asset) const {
+	// Collect the sparse accessors upfront, so that independent accessors can be expanded in
+	// parallel. The dense data is only appended to the asset after all jobs have joined, as the
+	// buffers and bufferViews vectors must not be mutated concurrently.
+	SmallVector<Accessor*, 8> sparseAccessors;
+	for (auto& accessor : asset.accessors) {
+		if (accessor.sparse.has_value())
+			sparseAccessors.emplace_back(&accessor);
+	}
+
+	if (sparseAccessors.empty())
+		return Error::None;
+
+	std::vector<std::vector<std::uint8_t>> results(sparseAccessors.size());
+	SmallVector<Error, 8> errors(sparseAccessors.size(), Error::None);
+
+	// Returns the in-memory bytes a buffer view starts at, or nullptr when the backing buffer
+	// was not loaded.
+	auto getViewBytes = [&asset](std::size_t viewIndex) -> const std::byte* {
+		const auto& view = asset.bufferViews[viewIndex];
+		const std::byte* bufferBytes = std::visit(visitor {
+			[](const auto&) -> const std::byte* {
+				return nullptr;
+			},
+			[](const sources::Vector& vec) {
+				return reinterpret_cast<const std::byte*>(vec.bytes.data());
+			},
+			[](const sources::ByteView& bv) {
+				return bv.bytes.data();
+			},
+		}, asset.buffers[view.bufferIndex].data);
+		if (bufferBytes == nullptr)
+			return nullptr;
+		return bufferBytes + view.byteOffset;
+	};
+
+	auto materialize = [&](std::size_t job) {
+		auto& accessor = *sparseAccessors[job];
+		const auto& sparse = *accessor.sparse;
+		auto& dense = results[job];
+
+		auto elementSize = static_cast<std::size_t>(getElementByteSize(accessor.type, accessor.componentType));
+		if (elementSize == 0 || sparse.indicesBufferView >= asset.bufferViews.size()
+				|| sparse.valuesBufferView >= asset.bufferViews.size()) {
+			errors[job] = Error::InvalidGltf;
+			return;
+		}
+
+		// The base values, or zeroes when the accessor has no buffer view, as the spec
+		// mandates for sparse morph targets.
+		dense.resize(accessor.count * elementSize);
+		if (accessor.bufferViewIndex.has_value()) {
+			const auto& baseView = asset.bufferViews[*accessor.bufferViewIndex];
+			const auto* baseBytes = getViewBytes(*accessor.bufferViewIndex);
+			if (baseBytes == nullptr) {
+				errors[job] = Error::MissingExternalBuffer;
+				return;
+			}
+			baseBytes += accessor.byteOffset;
+
+			auto srcStride = baseView.byteStride.value_or(elementSize);
+			if (srcStride == elementSize) {
+				std::memcpy(dense.data(), baseBytes, dense.size());
+			} else {
+				for (std::size_t i = 0; i < accessor.count; ++i)
+					std::memcpy(dense.data() + i * elementSize, baseBytes + i * srcStride, elementSize);
+			}
+		}
+
+		const auto* indexBytes = getViewBytes(sparse.indicesBufferView);
+		const auto* valueBytes = getViewBytes(sparse.valuesBufferView);
+		if (indexBytes == nullptr || valueBytes == nullptr) {
+			errors[job] = Error::MissingExternalBuffer;
+			return;
+		}
+		indexBytes += sparse.indicesByteOffset;
+		valueBytes += sparse.valuesByteOffset;
+
+		// Scatter the displacement values over the base data. Both arrays are tightly packed
+		// per spec. The loop is bound by the random-access stores, so a plain per-element copy
+		// is as fast as it gets here.
+		auto indexSize = static_cast<std::size_t>(getComponentBitSize(sparse.indexComponentType)) / 8;
+		for (std::size_t i = 0; i < sparse.count; ++i) {
+			std::size_t index;
+			switch (sparse.indexComponentType) {
+				case ComponentType::UnsignedByte: {
+					index = static_cast<std::size_t>(*reinterpret_cast<const std::uint8_t*>(indexBytes + i * indexSize));
+					break;
+				}
+				case ComponentType::UnsignedShort: {
+					std::uint16_t value;
+					std::memcpy(&value, indexBytes + i * indexSize, sizeof value);
+					index = value;
+					break;
+				}
+				case ComponentType::UnsignedInt: {
+					std::uint32_t value;
+					std::memcpy(&value, indexBytes + i * indexSize, sizeof value);
+					index = value;
+					break;
+				}
+				default: {
+					errors[job] = Error::InvalidGltf;
+					return;
+				}
+			}
+
+			if (index >= accessor.count) {
+				errors[job] = Error::InvalidGltf;
+				return;
+			}
+			std::memcpy(dense.data() + index * elementSize, valueBytes + i * elementSize, elementSize);
+		}
+	};
+
+	if (hasBit(options, Options::ParallelParse) && sparseAccessors.size() > 1) {
+		SmallVector<std::thread, 8> workers;
+		workers.reserve(sparseAccessors.size());
+		for (std::size_t i = 0; i < sparseAccessors.size(); ++i)
+			workers.emplace_back(materialize, i);
+		for (auto& worker : workers)
+			worker.join();
+	} else {
+		for (std::size_t i = 0; i < sparseAccessors.size(); ++i)
+			materialize(i);
+	}
+
+	for (const auto error : errors) {
+		if (error != Error::None)
+			return error;
+	}
+
+	// Append the dense data and retarget the accessors. Each byte vector becomes its own
+	// buffer and buffer view, like the decompression stages do it.
+	for (std::size_t job = 0; job < results.size(); ++job) {
+		auto& accessor = *sparseAccessors[job];
+
+		sources::Vector denseSource = {};
+		denseSource.mimeType = MimeType::GltfBuffer;
+		denseSource.bytes = std::move(results[job]);
+
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = denseSource.bytes.size();
+
+		auto& view = asset.bufferViews.emplace_back();
+		view.bufferIndex = asset.buffers.size() - 1;
+		view.byteOffset = 0;
+		view.byteLength = denseSource.bytes.size();
+		buffer.data = std::move(denseSource);
+
+		accessor.bufferViewIndex = asset.bufferViews.size() - 1;
+		accessor.byteOffset = 0;
+		accessor.sparse.reset();
+	}
+
+	return Error::None;
+}
+
+fg::Parser::Parser(Extensions extensionsToLoad, std::size_t initialArenaSize) noexcept {
     std::call_once(crcInitialisation, initialiseCrc);
     jsonParser = std::make_unique<simdjson::dom::parser>();
-    config.extensions = extensionsToLoad;
+    // Extensions that were compiled out can never be enabled at runtime.
+    config.extensions = extensionsToLoad & compiledExtensions;
+    this->initialArenaSize = initialArenaSize;
 }
 
-fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), config(other.config) {}
+fg::Parser::Parser(Parser&& other) noexcept : jsonParser(std::move(other.jsonParser)), config(other.config),
+        resourceAllocator(std::move(other.resourceAllocator)), statsCollector(std::move(other.statsCollector)),
+        initialArenaSize(other.initialArenaSize) {}
 
 fg::Parser& fg::Parser::operator=(Parser&& other) noexcept {
     jsonParser = std::move(other.jsonParser);
     config = other.config;
+    resourceAllocator = std::move(other.resourceAllocator);
+    statsCollector = std::move(other.statsCollector);
+    initialArenaSize = other.initialArenaSize;
     return *this;
 }
 
@@ -3058,9 +4549,20 @@ fg::Expected<fg::Asset> fg::Parser::loadGLTF(GltfDataBuffer* buffer, fs::path di
 
     auto view = padded_string_view(reinterpret_cast<const std::uint8_t*>(buffer->bufferPointer), jsonLength, buffer->allocatedSize);
 	simdjson::dom::object root;
+#if FASTGLTF_ENABLE_STATS
+    if (statsCollector == nullptr)
+        statsCollector = std::make_unique<LoadStatsCollector>();
+    statsCollector->reset();
+    auto jsonBegin = std::chrono::steady_clock::now();
+#endif
     if (auto error = jsonParser->parse(view).get(root); error != SUCCESS) {
 	    return Expected<Asset>(Error::InvalidJson);
     }
+#if FASTGLTF_ENABLE_STATS
+    statsCollector->jsonParseNanoseconds = elapsedNanoseconds(jsonBegin);
+    if (config.spanCallback != nullptr)
+        config.spanCallback("json_parse", statsCollector->jsonParseNanoseconds, config.userPointer);
+#endif
 
 	return parse(root, categories);
 }
@@ -3108,9 +4610,20 @@ fg::Expected<fg::Asset> fg::Parser::loadBinaryGLTF(GltfDataBuffer* buffer, fs::p
     offset += jsonChunk.chunkLength;
 
 	simdjson::dom::object root;
+#if FASTGLTF_ENABLE_STATS
+    if (statsCollector == nullptr)
+        statsCollector = std::make_unique<LoadStatsCollector>();
+    statsCollector->reset();
+    auto jsonBegin = std::chrono::steady_clock::now();
+#endif
     if (jsonParser->parse(jsonChunkView).get(root) != SUCCESS) {
 	    return Expected<Asset>(Error::InvalidJson);
     }
+#if FASTGLTF_ENABLE_STATS
+    statsCollector->jsonParseNanoseconds = elapsedNanoseconds(jsonBegin);
+    if (config.spanCallback != nullptr)
+        config.spanCallback("json_parse", statsCollector->jsonParseNanoseconds, config.userPointer);
+#endif
 
     // Is there enough room for another chunk header?
     if (header.length > (offset + sizeof(BinaryGltfChunk))) {
@@ -3150,6 +4663,52 @@ fg::Expected<fg::Asset> fg::Parser::loadBinaryGLTF(GltfDataBuffer* buffer, fs::p
 	return parse(root, categories);
 }
 
+fg::Expected<fg::Asset> fg::Parser::loadBinaryGLTF(GlbStream& stream, fs::path directory, Options options, Category categories) {
+    using namespace simdjson;
+
+    // If we never have to load the files ourselves, we're fine with the directory being invalid/blank.
+    if (hasBit(options, Options::LoadExternalBuffers) && !fs::is_directory(directory)) {
+        return Expected<Asset>(Error::InvalidPath);
+    }
+
+    if (!stream.canStartParse()) {
+        return Expected<Asset>(Error::InvalidGLB);
+    }
+
+    this->options = options;
+    this->directory = directory;
+
+    simdjson::padded_string_view jsonChunkView(stream.jsonBytes.data(), stream.jsonLength, stream.jsonBytes.size());
+
+    simdjson::dom::object root;
+#if FASTGLTF_ENABLE_STATS
+    if (statsCollector == nullptr)
+        statsCollector = std::make_unique<LoadStatsCollector>();
+    statsCollector->reset();
+    auto jsonBegin = std::chrono::steady_clock::now();
+#endif
+    if (jsonParser->parse(jsonChunkView).get(root) != SUCCESS) {
+        return Expected<Asset>(Error::InvalidJson);
+    }
+#if FASTGLTF_ENABLE_STATS
+    statsCollector->jsonParseNanoseconds = elapsedNanoseconds(jsonBegin);
+    if (config.spanCallback != nullptr)
+        config.spanCallback("json_parse", statsCollector->jsonParseNanoseconds, config.userPointer);
+#endif
+
+    if (stream.binaryLength > 0) {
+        // The BIN chunk always gets referenced through the stream's storage, which is already
+        // allocated to its final size, so the view stays valid while the remaining bytes land.
+        // Options::LoadGLBBuffers cannot be honoured here, as there may be nothing to copy yet.
+        sources::ByteView glbByteView = {};
+        glbByteView.bytes = span<const std::byte>(reinterpret_cast<const std::byte*>(stream.binaryBytes.data()), stream.binaryLength);
+        glbByteView.mimeType = MimeType::GltfBuffer;
+        glbBuffer = glbByteView;
+    }
+
+    return parse(root, categories);
+}
+
 void fg::Parser::setBufferAllocationCallback(BufferMapCallback* mapCallback, BufferUnmapCallback* unmapCallback) noexcept {
 	if (mapCallback == nullptr)
 		unmapCallback = nullptr;
@@ -3161,11 +4720,119 @@ void fg::Parser::setBase64DecodeCallback(Base64DecodeCallback* decodeCallback) n
     config.decodeCallback = decodeCallback;
 }
 
+void fg::Parser::setCategoryCallback(CategoryCallback* categoryCallback) noexcept {
+    config.categoryCallback = categoryCallback;
+}
+
+void fg::Parser::setBufferLoadCallback(BufferLoadCallback* loadCallback, BufferLoadJoinCallback* joinCallback) noexcept {
+	if (loadCallback == nullptr)
+		joinCallback = nullptr;
+	config.loadCallback = loadCallback;
+	config.loadJoinCallback = joinCallback;
+}
+
+void fg::Parser::setSpanCallback(SpanCallback* callback) noexcept {
+    config.spanCallback = callback;
+}
+
+fg::LoadStats fg::Parser::getLastLoadStats() const noexcept {
+    LoadStats stats = {};
+    if (statsCollector == nullptr)
+        return stats;
+
+    stats.jsonParseNanoseconds = statsCollector->jsonParseNanoseconds;
+    stats.base64DecodeNanoseconds = statsCollector->base64DecodeNanoseconds;
+    stats.base64DecodedBytes = statsCollector->base64DecodedBytes;
+    stats.fileReadNanoseconds = statsCollector->fileReadNanoseconds;
+    stats.arenaBytesAllocated = statsCollector->arenaBytesAllocated;
+    for (std::size_t i = 0; i < stats.categoryParseNanoseconds.size(); ++i) {
+        stats.categoryParseNanoseconds[i] = statsCollector->categoryParseNanoseconds[i];
+    }
+    return stats;
+}
+
 void fg::Parser::setUserPointer(void* pointer) noexcept {
     config.userPointer = pointer;
 }
 #pragma endregion
 
+#pragma region ParserPool
+fg::ParserPool::ParserPool(Extensions extensionsToLoad, std::size_t threadCount) noexcept
+		: extensions(extensionsToLoad), threadCount(threadCount == 0 ? 1 : threadCount) {}
+
+std::vector<fg::Expected<fg::Asset>> fg::ParserPool::loadAll(const std::vector<fs::path>& paths, Options options, Category categories) {
+	std::vector<Expected<Asset>> results;
+	results.reserve(paths.size());
+	for (std::size_t i = 0; i < paths.size(); ++i)
+		results.emplace_back(Error::None);
+
+	// Workers claim the next unclaimed file from this counter, so a worker stuck on a large
+	// file doesn't hold back the remaining files.
+	std::atomic<std::size_t> nextFile(0);
+
+	auto worker = [&]() {
+		// One Parser per worker, reused for every file it picks up, keeping the simdjson
+		// buffers and the preallocated arena warm across files.
+		Parser parser(extensions);
+		GltfDataBuffer data;
+		for (;;) {
+			auto index = nextFile.fetch_add(1, std::memory_order_relaxed);
+			if (index >= paths.size())
+				break;
+			const auto& filePath = paths[index];
+
+			if (!data.loadFromFile(filePath)) {
+				results[index] = Expected<Asset>(Error::InvalidPath);
+			} else {
+				auto directory = filePath.parent_path();
+				switch (determineGltfFileType(&data)) {
+					case GltfType::glTF: {
+						results[index] = parser.loadGLTF(&data, std::move(directory), options, categories);
+						break;
+					}
+					case GltfType::GLB: {
+						results[index] = parser.loadBinaryGLTF(&data, std::move(directory), options, categories);
+						break;
+					}
+					default: {
+						results[index] = Expected<Asset>(Error::InvalidGltf);
+						break;
+					}
+				}
+			}
+
+			if (loadedCallback != nullptr)
+				loadedCallback(index, results[index], userPointer);
+		}
+	};
+
+	auto workerCount = (std::min)(threadCount, paths.empty() ? std::size_t(1) : paths.size());
+	if (workerCount <= 1) {
+		worker();
+		return results;
+	}
+
+	SmallVector<std::thread, 8> workers;
+	workers.reserve(workerCount - 1);
+	for (std::size_t i = 0; i + 1 < workerCount; ++i)
+		workers.emplace_back(worker);
+	// The calling thread works on the batch too instead of only waiting.
+	worker();
+	for (auto& thread : workers)
+		thread.join();
+
+	return results;
+}
+
+void fg::ParserPool::setAssetLoadedCallback(AssetLoadedCallback* callback) noexcept {
+	loadedCallback = callback;
+}
+
+void fg::ParserPool::setUserPointer(void* pointer) noexcept {
+	userPointer = pointer;
+}
+#pragma endregion
+
 #ifdef _MSC_VER
 #pragma warning(pop)
 #endif
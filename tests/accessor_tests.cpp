@@ -1,11 +1,17 @@
+#include <cmath>
+
 #include <catch2/catch_test_macros.hpp>
 
+#include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
 #include <fastgltf/parser.hpp>
 #include <fastgltf/tools.hpp>
 #include "gltf_path.hpp"
 
+template<>
+struct fastgltf::ElementTraits<glm::vec2> : fastgltf::ElementTraitsBase<glm::vec2, AccessorType::Vec2, float> {};
+
 template<>
 struct fastgltf::ElementTraits<glm::vec3> : fastgltf::ElementTraitsBase<glm::vec3, AccessorType::Vec3, float> {};
 
@@ -98,6 +104,25 @@ TEST_CASE("Test accessor", "[gltf-tools]") {
 			}
 			REQUIRE(std::memcmp(dstCopy.get(), checkData, secondAccessor.count * sizeof(glm::vec3)) == 0);
 		}
+
+		SECTION("Prepared accessor layout") {
+			auto layout = fastgltf::prepareAccessor(asset.get(), secondAccessor);
+			REQUIRE(layout.base != nullptr);
+			REQUIRE(layout.count == secondAccessor.count);
+
+			REQUIRE(*checkData == fastgltf::getAccessorElement<glm::vec3>(layout, 0));
+
+			auto dstCopy = std::make_unique<glm::vec3[]>(secondAccessor.count);
+			fastgltf::copyFromAccessor<glm::vec3>(layout, dstCopy.get());
+			REQUIRE(std::memcmp(dstCopy.get(), checkData, secondAccessor.count * sizeof(glm::vec3)) == 0);
+
+			std::size_t i = 0;
+			fastgltf::iterateAccessor<glm::vec3>(layout, [&](auto&& v3) {
+				dstCopy[i++] = std::forward<glm::vec3>(v3);
+			});
+			REQUIRE(i == secondAccessor.count);
+			REQUIRE(std::memcmp(dstCopy.get(), checkData, secondAccessor.count * sizeof(glm::vec3)) == 0);
+		}
 	}
 }
 
@@ -190,3 +215,238 @@ TEST_CASE("Test sparse accessor", "[gltf-tools]") {
 		REQUIRE(std::memcmp(dstCopy.get(), checkValues.get(), secondAccessor.count * sizeof(glm::vec3)) == 0);
 	}
 }
+
+TEST_CASE("Test sparse accessor materialization", "[gltf-tools]") {
+	auto simpleSparseAccessor = sampleModels / "2.0" / "SimpleSparseAccessor" / "glTF";
+	auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+	REQUIRE(jsonData->loadFromFile(simpleSparseAccessor / "SimpleSparseAccessor.gltf"));
+
+	static constexpr auto categories = fastgltf::Category::Buffers | fastgltf::Category::BufferViews | fastgltf::Category::Accessors;
+
+	fastgltf::Parser parser;
+	auto sparseAsset = parser.loadGLTF(jsonData.get(), simpleSparseAccessor, fastgltf::Options::LoadExternalBuffers, categories);
+	REQUIRE(sparseAsset.error() == fastgltf::Error::None);
+
+	auto denseAsset = parser.loadGLTF(jsonData.get(), simpleSparseAccessor,
+			fastgltf::Options::LoadExternalBuffers | fastgltf::Options::MaterializeSparseAccessors, categories);
+	REQUIRE(denseAsset.error() == fastgltf::Error::None);
+
+	REQUIRE(sparseAsset->accessors[1].sparse.has_value());
+
+	// The materialized accessor has to reference a freshly appended dense buffer view instead.
+	auto& denseAccessor = denseAsset->accessors[1];
+	REQUIRE(!denseAccessor.sparse.has_value());
+	REQUIRE(denseAccessor.bufferViewIndex.has_value());
+	REQUIRE(denseAccessor.bufferViewIndex.value() >= sparseAsset->bufferViews.size());
+	REQUIRE(denseAccessor.byteOffset == 0);
+
+	// Reading through the dense accessor has to yield the exact values the sparse one decodes to.
+	auto& sparseAccessor = sparseAsset->accessors[1];
+	REQUIRE(denseAccessor.count == sparseAccessor.count);
+	auto sparseCopy = std::make_unique<glm::vec3[]>(sparseAccessor.count);
+	fastgltf::copyFromAccessor<glm::vec3>(sparseAsset.get(), sparseAccessor, sparseCopy.get());
+	auto denseCopy = std::make_unique<glm::vec3[]>(denseAccessor.count);
+	fastgltf::copyFromAccessor<glm::vec3>(denseAsset.get(), denseAccessor, denseCopy.get());
+	REQUIRE(std::memcmp(denseCopy.get(), sparseCopy.get(), sparseAccessor.count * sizeof(glm::vec3)) == 0);
+}
+
+TEST_CASE("Test bulk component conversion", "[gltf-tools]") {
+	// Builds an asset by hand so that the quantized conversion paths of copyFromAccessor can be
+	// tested without a quantized sample model.
+	fastgltf::Asset asset;
+
+	std::vector<std::uint8_t> quantized(40);
+	for (std::size_t i = 0; i < quantized.size(); ++i) {
+		quantized[i] = static_cast<std::uint8_t>(i * 6);
+	}
+
+	fastgltf::sources::Vector vector = {};
+	vector.bytes = quantized;
+	auto& buffer = asset.buffers.emplace_back();
+	buffer.byteLength = quantized.size();
+	buffer.data = std::move(vector);
+
+	auto& view = asset.bufferViews.emplace_back();
+	view.bufferIndex = 0;
+	view.byteOffset = 0;
+	view.byteLength = quantized.size();
+
+	auto& accessor = asset.accessors.emplace_back();
+	accessor.bufferViewIndex = 0;
+	accessor.byteOffset = 0;
+	accessor.componentType = fastgltf::ComponentType::UnsignedByte;
+	accessor.type = fastgltf::AccessorType::Scalar;
+	accessor.normalized = true;
+	accessor.count = quantized.size();
+
+	std::vector<float> floats(accessor.count);
+	fastgltf::copyFromAccessor<float>(asset, accessor, floats.data());
+	for (std::size_t i = 0; i < floats.size(); ++i) {
+		// The bulk conversion and the scalar conversion may differ by an ulp at most.
+		auto expected = fastgltf::getAccessorElement<float>(asset, accessor, i);
+		REQUIRE(std::fabs(floats[i] - expected) < 1e-6f);
+	}
+
+	// The same data read as raw u8 indices promoted to u32.
+	accessor.normalized = false;
+	std::vector<std::uint32_t> indices(accessor.count);
+	fastgltf::copyFromAccessor<std::uint32_t>(asset, accessor, indices.data());
+	for (std::size_t i = 0; i < indices.size(); ++i) {
+		REQUIRE(indices[i] == quantized[i]);
+	}
+}
+
+TEST_CASE("Test animation cache sampling", "[gltf-tools]") {
+	auto boxAnimated = sampleModels / "2.0" / "BoxAnimated" / "glTF";
+	fastgltf::GltfDataBuffer jsonData;
+	REQUIRE(jsonData.loadFromFile(boxAnimated / "BoxAnimated.gltf"));
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGLTF(&jsonData, boxAnimated, fastgltf::Options::LoadExternalBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(!asset->animations.empty());
+
+	const auto& animation = asset->animations.front();
+	auto cache = fastgltf::prepareAnimation(asset.get(), 0);
+	REQUIRE(cache.samplers.size() == animation.samplers.size());
+
+	for (std::size_t i = 0; i < cache.samplers.size(); ++i) {
+		const auto& cached = cache.samplers[i];
+		const auto& input = asset->accessors[animation.samplers[i].inputAccessor];
+		REQUIRE(cached.times.size() == input.count);
+		REQUIRE(cached.values.size() == cached.times.size() * cached.valuesPerKeyframe);
+		REQUIRE(std::is_sorted(cached.times.begin(), cached.times.end()));
+	}
+
+	// Sampling halfway through the animation has to write a normalized rotation into the
+	// animated node.
+	const auto& firstSampler = cache.samplers.front();
+	auto midTime = (firstSampler.times.front() + firstSampler.times.back()) * 0.5f;
+	fastgltf::evaluateAnimation(asset.get(), 0, cache, midTime);
+
+	for (const auto& channel : animation.channels) {
+		if (channel.path != fastgltf::AnimationPath::Rotation)
+			continue;
+		const auto* trs = std::get_if<fastgltf::Node::TRS>(&asset->nodes[channel.nodeIndex].transform);
+		REQUIRE(trs != nullptr);
+		auto& q = trs->rotation;
+		auto length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		REQUIRE(std::fabs(length - 1.0f) < 1e-5f);
+	}
+}
+
+TEST_CASE("Test parallel accessor copy", "[gltf-tools]") {
+	auto boxPath = sampleModels / "2.0" / "Box" / "glTF";
+	fastgltf::GltfDataBuffer jsonData;
+	REQUIRE(jsonData.loadFromFile(boxPath / "Box.gltf"));
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGLTF(&jsonData, boxPath, fastgltf::Options::LoadExternalBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+
+	const auto& primitive = asset->meshes.front().primitives.front();
+	const auto& positions = asset->accessors[primitive.findAttribute("POSITION")->second];
+
+	std::vector<glm::vec3> serial(positions.count);
+	std::vector<glm::vec3> parallel(positions.count);
+	fastgltf::copyFromAccessor<glm::vec3>(asset.get(), positions, serial.data());
+	fastgltf::copyFromAccessorParallel<glm::vec3>(asset.get(), positions, parallel.data(), 4);
+
+	for (std::size_t i = 0; i < positions.count; ++i) {
+		REQUIRE(parallel[i] == serial[i]);
+	}
+}
+
+TEST_CASE("Test scene flattening", "[gltf-tools]") {
+	auto boxAnimated = sampleModels / "2.0" / "BoxAnimated" / "glTF";
+	fastgltf::GltfDataBuffer jsonData;
+	REQUIRE(jsonData.loadFromFile(boxAnimated / "BoxAnimated.gltf"));
+
+	fastgltf::Parser parser;
+	auto asset = parser.loadGLTF(&jsonData, boxAnimated, fastgltf::Options::LoadExternalBuffers);
+	REQUIRE(asset.error() == fastgltf::Error::None);
+	REQUIRE(!asset->scenes.empty());
+
+	auto flattened = fastgltf::flattenScene(asset.get(), 0);
+	REQUIRE(!flattened.nodes.empty());
+
+	for (std::size_t i = 0; i < flattened.nodes.size(); ++i) {
+		const auto& node = flattened.nodes[i];
+		REQUIRE(node.nodeIndex < asset->nodes.size());
+
+		if (node.parentIndex == fastgltf::FlattenedNode::noParent) {
+			// Root nodes carry their local transform unchanged.
+			auto local = fastgltf::getLocalTransformMatrix(asset->nodes[node.nodeIndex]);
+			for (std::size_t c = 0; c < local.size(); ++c) {
+				REQUIRE(node.globalTransform[c] == local[c]);
+			}
+		} else {
+			// The topological order guarantees that parents precede their children.
+			REQUIRE(node.parentIndex < i);
+
+			auto expected = fastgltf::multiplyTransformMatrices(
+					flattened.nodes[node.parentIndex].globalTransform,
+					fastgltf::getLocalTransformMatrix(asset->nodes[node.nodeIndex]));
+			for (std::size_t c = 0; c < expected.size(); ++c) {
+				REQUIRE(node.globalTransform[c] == expected[c]);
+			}
+		}
+	}
+}
+
+TEST_CASE("Test interleaved copy", "[gltf-tools]") {
+	// Builds an asset by hand with one position and one UV stream, then interleaves both into
+	// a packed vertex layout in a single pass.
+	fastgltf::Asset asset;
+
+	constexpr std::size_t vertexCount = 16;
+	std::vector<float> positions(vertexCount * 3);
+	for (std::size_t i = 0; i < positions.size(); ++i) {
+		positions[i] = static_cast<float>(i) * 0.5f;
+	}
+	std::vector<float> uvs(vertexCount * 2);
+	for (std::size_t i = 0; i < uvs.size(); ++i) {
+		uvs[i] = static_cast<float>(i) * 0.25f;
+	}
+
+	auto appendAccessor = [&](const float* data, std::size_t floatCount, fastgltf::AccessorType type) {
+		fastgltf::sources::Vector vector = {};
+		vector.bytes.resize(floatCount * sizeof(float));
+		std::memcpy(vector.bytes.data(), data, vector.bytes.size());
+		auto& buffer = asset.buffers.emplace_back();
+		buffer.byteLength = vector.bytes.size();
+		buffer.data = std::move(vector);
+
+		auto& view = asset.bufferViews.emplace_back();
+		view.bufferIndex = asset.buffers.size() - 1;
+		view.byteOffset = 0;
+		view.byteLength = buffer.byteLength;
+
+		auto& accessor = asset.accessors.emplace_back();
+		accessor.bufferViewIndex = asset.bufferViews.size() - 1;
+		accessor.byteOffset = 0;
+		accessor.componentType = fastgltf::ComponentType::Float;
+		accessor.type = type;
+		accessor.count = vertexCount;
+	};
+
+	appendAccessor(positions.data(), positions.size(), fastgltf::AccessorType::Vec3);
+	appendAccessor(uvs.data(), uvs.size(), fastgltf::AccessorType::Vec2);
+
+	struct Vertex {
+		glm::vec3 position;
+		glm::vec2 uv;
+	};
+
+	std::vector<Vertex> vertices(vertexCount);
+	std::array<fastgltf::InterleavedCopyDesc, 2> descs = {{
+		{ &asset.accessors[0], offsetof(Vertex, position) },
+		{ &asset.accessors[1], offsetof(Vertex, uv) },
+	}};
+	fastgltf::copyInterleaved<glm::vec3, glm::vec2>(asset, descs, vertices.data(), sizeof(Vertex));
+
+	for (std::size_t i = 0; i < vertexCount; ++i) {
+		REQUIRE(vertices[i].position == glm::vec3(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]));
+		REQUIRE(vertices[i].uv == glm::vec2(uvs[i * 2], uvs[i * 2 + 1]));
+	}
+}
@@ -4,6 +4,8 @@
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
+#include <simdjson.h>
+
 #include <fastgltf/base64.hpp>
 #include <fastgltf/types.hpp>
 #include <fastgltf/parser.hpp>
@@ -38,6 +40,11 @@ TEST_CASE("Check all base64 decoders", "[base64]") {
 #if defined(__x86_64__) || defined(_M_AMD64) || defined(_M_IX86)
     REQUIRE(bytes == fastgltf::base64::avx2_decode(testBase64));
     REQUIRE(bytes == fastgltf::base64::sse4_decode(testBase64));
+
+    // The AVX-512 kernel needs AVX-512VBMI, which most x86 machines don't have yet.
+    if (const auto* avx512 = simdjson::get_available_implementations()["icelake"]; avx512 != nullptr && avx512->supported_by_runtime_system()) {
+        REQUIRE(bytes == fastgltf::base64::avx512_decode(testBase64));
+    }
 #endif
 #if defined(__aarch64__)
     REQUIRE(bytes == fastgltf::base64::neon_decode(testBase64));
@@ -62,6 +69,11 @@ TEST_CASE("Check big base64 data decoding", "[base64]") {
     output.read(reinterpret_cast<char*>(decodedBytes.data()), static_cast<std::streamsize>(decodedBytes.size()));
 
     REQUIRE(bytes == decodedBytes);
+
+    // The parallel decoder has to produce the exact same output as the serial decoders.
+    std::vector<uint8_t> parallelBytes(decodedBytes.size());
+    fastgltf::base64::decode_inplace_parallel(encodedBytes, parallelBytes.data(), fastgltf::base64::getPadding(encodedBytes), 4);
+    REQUIRE(parallelBytes == decodedBytes);
 }
 
 TEST_CASE("Test base64 buffer decoding", "[base64]") {
@@ -1,4 +1,5 @@
 #include <cstdlib>
+#include <cstring>
 #include <random>
 
 #include <catch2/catch_approx.hpp>
@@ -175,6 +176,23 @@ TEST_CASE("Loading some basic glTF", "[gltf-loader]") {
         REQUIRE(!material.occlusionTexture.has_value());
     }
 
+    SECTION("Loading basic Cube.gltf in parallel") {
+        auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+        auto cubeJsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+        REQUIRE(cubeJsonData->loadFromFile(cubePath / "Cube.gltf"));
+
+        auto cube = parser.loadGLTF(cubeJsonData.get(), cubePath, fastgltf::Options::ParallelParse, fastgltf::Category::OnlyRenderable);
+        REQUIRE(cube.error() == fastgltf::Error::None);
+		REQUIRE(parser.validate(cube.get()) == fastgltf::Error::None);
+
+        REQUIRE(cube->nodes.size() == 1);
+        REQUIRE(cube->nodes.front().name == "Cube");
+        REQUIRE(cube->accessors.size() == 5);
+        REQUIRE(cube->bufferViews.size() == 5);
+        REQUIRE(cube->buffers.size() == 1);
+        REQUIRE(cube->materials.size() == 1);
+    }
+
     SECTION("Loading basic Box.gltf") {
         auto boxPath = sampleModels / "2.0" / "Box" / "glTF";
         auto boxJsonData = std::make_unique<fastgltf::GltfDataBuffer>();
@@ -343,6 +361,125 @@ TEST_CASE("Test allocation callbacks for embedded buffers", "[gltf-loader]") {
     }
 }
 
+TEST_CASE("Test buffer load callbacks for external buffers", "[gltf-loader]") {
+    auto boxPath = sampleModels / "2.0" / "Box" / "glTF";
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(boxPath / "Box.gltf"));
+
+    struct LoadContext {
+        std::vector<std::filesystem::path> requests;
+        bool joined = false;
+    } context;
+
+    auto loadCallback = [](const std::filesystem::path& path, std::uint64_t byteLength, void* userPointer) -> fastgltf::CustomBufferId {
+        REQUIRE(userPointer != nullptr);
+        REQUIRE(byteLength != 0);
+        auto* context = static_cast<LoadContext*>(userPointer);
+        context->requests.emplace_back(path);
+        return context->requests.size() - 1;
+    };
+    auto joinCallback = [](void* userPointer) {
+        static_cast<LoadContext*>(userPointer)->joined = true;
+    };
+
+    fastgltf::Parser parser;
+    parser.setUserPointer(&context);
+    parser.setBufferLoadCallback(loadCallback, joinCallback);
+    auto asset = parser.loadGLTF(jsonData.get(), boxPath, fastgltf::Options::LoadExternalBuffers, fastgltf::Category::Buffers);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+
+    REQUIRE(context.requests.size() == 1);
+    REQUIRE(context.requests.front().filename() == "Box0.bin");
+    REQUIRE(context.joined);
+
+    REQUIRE(asset->buffers.size() == 1);
+    const auto* customBuffer = std::get_if<fastgltf::sources::CustomBuffer>(&asset->buffers.front().data);
+    REQUIRE(customBuffer != nullptr);
+    REQUIRE(customBuffer->id == 0);
+}
+
+TEST_CASE("Test category completion callbacks", "[gltf-loader]") {
+    auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(cubePath / "Cube.gltf"));
+
+    fastgltf::Category completedCategories = fastgltf::Category::None;
+    auto categoryCallback = [](fastgltf::Asset* asset, fastgltf::Category category, void* userPointer) {
+        REQUIRE(asset != nullptr);
+        *static_cast<fastgltf::Category*>(userPointer) |= category;
+    };
+
+    fastgltf::Parser parser;
+    parser.setUserPointer(&completedCategories);
+    parser.setCategoryCallback(categoryCallback);
+    auto cube = parser.loadGLTF(jsonData.get(), cubePath, noOptions, fastgltf::Category::OnlyRenderable);
+    REQUIRE(cube.error() == fastgltf::Error::None);
+
+    // Every category that was requested and parsed has to have been reported through the callback.
+    REQUIRE(fastgltf::hasBit(completedCategories, fastgltf::Category::Buffers));
+    REQUIRE(fastgltf::hasBit(completedCategories, fastgltf::Category::Accessors));
+    REQUIRE(fastgltf::hasBit(completedCategories, fastgltf::Category::Meshes));
+    REQUIRE(fastgltf::hasBit(completedCategories, fastgltf::Category::Materials));
+}
+
+TEST_CASE("Test KHR_draco_mesh_compression parsing", "[gltf-loader]") {
+    auto dracoBox = sampleModels / "2.0" / "Box" / "glTF-Draco";
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(dracoBox / "Box.gltf"));
+
+    fastgltf::Parser parser(fastgltf::Extensions::KHR_draco_mesh_compression);
+    auto asset = parser.loadGLTF(jsonData.get(), dracoBox, noOptions, fastgltf::Category::Meshes);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+
+    REQUIRE(asset->meshes.size() == 1);
+    auto& primitive = asset->meshes.front().primitives.front();
+    REQUIRE(primitive.dracoCompression != nullptr);
+    REQUIRE(primitive.dracoCompression->bufferViewIndex == 0);
+    REQUIRE(primitive.dracoCompression->attributes.size() == 2);
+    for (const auto& [name, uniqueId] : primitive.dracoCompression->attributes) {
+        REQUIRE((name == "POSITION" || name == "NORMAL"));
+    }
+}
+
+TEST_CASE("Test meshopt decode option on uncompressed assets", "[gltf-loader]") {
+    auto boxPath = sampleModels / "2.0" / "Box" / "glTF";
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(boxPath / "Box.gltf"));
+
+    // The asset uses no EXT_meshopt_compression, so the option has to be a no-op regardless of
+    // whether fastgltf was compiled with meshoptimizer.
+    fastgltf::Parser parser(fastgltf::Extensions::EXT_meshopt_compression);
+    auto asset = parser.loadGLTF(jsonData.get(), boxPath,
+            fastgltf::Options::LoadExternalBuffers | fastgltf::Options::DecodeMeshoptCompression);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+    for (const auto& view : asset->bufferViews) {
+        REQUIRE(view.meshoptCompression == nullptr);
+    }
+}
+
+TEST_CASE("Test memory arena reuse across parses", "[gltf-loader]") {
+    auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(cubePath / "Cube.gltf"));
+
+    fastgltf::Parser parser(fastgltf::Extensions::None, 16384);
+
+    {
+        // When the previous asset is still alive, the parser may not reuse its arena.
+        auto first = parser.loadGLTF(jsonData.get(), cubePath, noOptions, fastgltf::Category::OnlyRenderable);
+        REQUIRE(first.error() == fastgltf::Error::None);
+        auto second = parser.loadGLTF(jsonData.get(), cubePath, noOptions, fastgltf::Category::OnlyRenderable);
+        REQUIRE(second.error() == fastgltf::Error::None);
+
+        REQUIRE(first->nodes.front().name == second->nodes.front().name);
+    }
+
+    // Both assets are gone now, so repeated parses reuse the rewound arena.
+    auto third = parser.loadGLTF(jsonData.get(), cubePath, noOptions, fastgltf::Category::OnlyRenderable);
+    REQUIRE(third.error() == fastgltf::Error::None);
+    REQUIRE(third->nodes.front().name == "Cube");
+}
+
 TEST_CASE("Test base64 decoding callbacks", "[gltf-loader]") {
     auto boxPath = sampleModels / "2.0" / "Box" / "glTF-Embedded";
     auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
@@ -558,3 +695,267 @@ TEST_CASE("Test accessors min/max", "[gltf-loader]") {
         REQUIRE(max->back() == 1.0);
     }
 }
+
+TEST_CASE("Test index generation for non-indexed primitives", "[gltf-loader]") {
+    auto triangle = sampleModels / "2.0" / "TriangleWithoutIndices" / "glTF";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(triangle / "TriangleWithoutIndices.gltf"));
+
+    fastgltf::Parser parser;
+    auto asset = parser.loadGLTF(&jsonData, triangle,
+        fastgltf::Options::LoadExternalBuffers | fastgltf::Options::GenerateMeshIndices);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+    REQUIRE(parser.validate(asset.get()) == fastgltf::Error::None);
+
+    REQUIRE(asset->meshes.size() == 1);
+    auto& primitive = asset->meshes.front().primitives.front();
+    REQUIRE(primitive.indicesAccessor.has_value());
+
+    auto& indexAccessor = asset->accessors[*primitive.indicesAccessor];
+    REQUIRE(indexAccessor.count == 3);
+    REQUIRE(indexAccessor.type == fastgltf::AccessorType::Scalar);
+    REQUIRE(indexAccessor.componentType == fastgltf::ComponentType::UnsignedShort);
+    REQUIRE(indexAccessor.bufferViewIndex.has_value());
+
+    // The triangle has three unique vertices, so the indices are trivial and the vertex
+    // stream stays untouched.
+    auto& view = asset->bufferViews[*indexAccessor.bufferViewIndex];
+    auto* generated = std::get_if<fastgltf::sources::Vector>(&asset->buffers[view.bufferIndex].data);
+    REQUIRE(generated != nullptr);
+    REQUIRE(generated->bytes.size() == 3 * sizeof(std::uint16_t));
+    std::array<std::uint16_t, 3> indices = {};
+    std::memcpy(indices.data(), generated->bytes.data(), generated->bytes.size());
+    REQUIRE(indices == std::array<std::uint16_t, 3> {{ 0, 1, 2 }});
+}
+
+TEST_CASE("Test load statistics API", "[gltf-loader]") {
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->loadFromFile(path / "basic_gltf.gltf"));
+
+    fastgltf::Parser parser;
+    auto asset = parser.loadGLTF(jsonData.get(), path);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+
+    // The asset references no base64 data URIs and no external files, so those counters are
+    // zero regardless of whether fastgltf was compiled with FASTGLTF_ENABLE_STATS.
+    auto stats = parser.getLastLoadStats();
+    REQUIRE(stats.base64DecodedBytes == 0);
+    REQUIRE(stats.base64DecodeNanoseconds == 0);
+    REQUIRE(stats.fileReadNanoseconds == 0);
+
+#if FASTGLTF_ENABLE_STATS
+    REQUIRE(stats.jsonParseNanoseconds > 0);
+    REQUIRE(stats.arenaBytesAllocated > 0);
+#else
+    REQUIRE(stats.jsonParseNanoseconds == 0);
+    REQUIRE(stats.arenaBytesAllocated == 0);
+#endif
+}
+
+TEST_CASE("Test asset name index", "[gltf-loader]") {
+    // Builds an asset by hand so that duplicate and empty names can be covered without a
+    // matching sample model.
+    fastgltf::Asset asset;
+    // Reserve upfront so that the later mutation doesn't reallocate the nodes vector, which
+    // would leave the stale index pointing at freed names.
+    asset.nodes.reserve(4);
+    auto& node0 = asset.nodes.emplace_back();
+    node0.name = "root";
+    auto& node1 = asset.nodes.emplace_back();
+    node1.name = "wheel";
+    auto& node2 = asset.nodes.emplace_back();
+    node2.name = "wheel";
+    asset.materials.emplace_back();
+    auto& mesh = asset.meshes.emplace_back();
+    mesh.name = "hull";
+
+    // The index is built lazily on the first lookup. Duplicate names resolve to the smallest
+    // index, and unnamed objects are not indexed.
+    REQUIRE(asset.findNodeByName("root") == 0);
+    REQUIRE(asset.findNodeByName("wheel") == 1);
+    REQUIRE(!asset.findNodeByName("chassis").has_value());
+    REQUIRE(asset.findMeshByName("hull") == 0);
+    REQUIRE(!asset.findMaterialByName("").has_value());
+
+    // Mutations are only picked up after an explicit rebuild.
+    auto& node3 = asset.nodes.emplace_back();
+    node3.name = "chassis";
+    REQUIRE(!asset.findNodeByName("chassis").has_value());
+    asset.buildNameIndex();
+    REQUIRE(asset.findNodeByName("chassis") == 3);
+}
+
+TEST_CASE("Test streaming GLB load", "[gltf-loader]") {
+    // Builds a tiny GLB in memory and feeds it to a GlbStream in deliberately awkward chunk
+    // sizes, parsing as soon as the stream allows — before the BIN chunk has fully arrived.
+    std::string json = R"({"asset":{"version":"2.0"},"buffers":[{"byteLength":40}],)"
+            R"("bufferViews":[{"buffer":0,"byteOffset":0,"byteLength":40}]})";
+    while (json.size() % 4 != 0)
+        json.push_back(' ');
+
+    std::vector<std::uint8_t> bin(40);
+    for (std::size_t i = 0; i < bin.size(); ++i)
+        bin[i] = static_cast<std::uint8_t>(i);
+
+    std::vector<std::uint8_t> glb;
+    auto push32 = [&](std::uint32_t value) {
+        for (int i = 0; i < 4; ++i)
+            glb.push_back(static_cast<std::uint8_t>((value >> (i * 8)) & 0xFF));
+    };
+    push32(0x46546C67); // glTF
+    push32(2);
+    push32(static_cast<std::uint32_t>(12 + 8 + json.size() + 8 + bin.size()));
+    push32(static_cast<std::uint32_t>(json.size()));
+    push32(0x4E4F534A); // JSON
+    glb.insert(glb.end(), json.begin(), json.end());
+    push32(static_cast<std::uint32_t>(bin.size()));
+    push32(0x004E4942); // BIN
+    glb.insert(glb.end(), bin.begin(), bin.end());
+
+    fastgltf::GlbStream stream;
+    fastgltf::Parser parser;
+    auto asset = fastgltf::Expected<fastgltf::Asset>(fastgltf::Error::None);
+    bool parsed = false;
+    for (std::size_t offset = 0; offset < glb.size();) {
+        auto take = std::min<std::size_t>(7, glb.size() - offset);
+        REQUIRE(stream.feedBytes(glb.data() + offset, take) == fastgltf::Error::None);
+        offset += take;
+        if (!parsed && stream.canStartParse()) {
+            asset = parser.loadBinaryGLTF(stream, path);
+            REQUIRE(asset.error() == fastgltf::Error::None);
+            REQUIRE(stream.remainingBinaryBytes() > 0);
+            parsed = true;
+        }
+    }
+    REQUIRE(parsed);
+    REQUIRE(stream.isComplete());
+    REQUIRE(stream.remainingBinaryBytes() == 0);
+
+    // The buffer has to reference the stream storage, with all BIN bytes in place by now.
+    REQUIRE(asset->buffers.size() == 1);
+    auto* byteView = std::get_if<fastgltf::sources::ByteView>(&asset->buffers[0].data);
+    REQUIRE(byteView != nullptr);
+    REQUIRE(byteView->bytes.size() == bin.size());
+    REQUIRE(std::memcmp(byteView->bytes.data(), bin.data(), bin.size()) == 0);
+
+    // Garbage is rejected as soon as the header magic cannot match.
+    fastgltf::GlbStream garbageStream;
+    std::array<std::uint8_t, 12> garbage = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 };
+    REQUIRE(garbageStream.feedBytes(garbage.data(), garbage.size()) == fastgltf::Error::InvalidGLB);
+    REQUIRE(!garbageStream.canStartParse());
+}
+
+TEST_CASE("Test parser pool batch loading", "[gltf-loader]") {
+    std::vector<std::filesystem::path> files;
+    for (int i = 0; i < 8; ++i)
+        files.emplace_back(path / "basic_gltf.gltf");
+    files.emplace_back(path / "does_not_exist.gltf");
+
+    static std::atomic<std::size_t> loadedCount;
+    loadedCount = 0;
+
+    fastgltf::ParserPool pool(fastgltf::Extensions::None, 4);
+    pool.setAssetLoadedCallback([](std::size_t, fastgltf::Expected<fastgltf::Asset>&, void*) {
+        loadedCount.fetch_add(1);
+    });
+
+    auto results = pool.loadAll(files);
+    REQUIRE(results.size() == files.size());
+    REQUIRE(loadedCount.load() == files.size());
+    for (std::size_t i = 0; i < 8; ++i) {
+        REQUIRE(results[i].error() == fastgltf::Error::None);
+        REQUIRE(results[i]->assetInfo.has_value());
+    }
+    REQUIRE(results[8].error() == fastgltf::Error::InvalidPath);
+
+    // The same pool can run further batches with its parsers kept warm.
+    auto again = pool.loadAll({ files.front() });
+    REQUIRE(again.size() == 1);
+    REQUIRE(again[0].error() == fastgltf::Error::None);
+}
+
+TEST_CASE("Test asset compaction", "[gltf-loader]") {
+    auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(cubePath / "Cube.gltf"));
+
+    fastgltf::Parser parser;
+    auto asset = parser.loadGLTF(&jsonData, cubePath, fastgltf::Options::LoadExternalBuffers);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+
+    auto meshName = std::string(asset->meshes.front().name);
+    auto attributeCount = asset->meshes.front().primitives.front().attributes.size();
+    auto accessorCount = asset->accessors.size();
+
+    asset->compact();
+
+    // Everything has to read back identically from the new arena.
+    REQUIRE(asset->accessors.size() == accessorCount);
+    REQUIRE(asset->meshes.front().name == meshName.c_str());
+    REQUIRE(asset->meshes.front().primitives.front().attributes.size() == attributeCount);
+    REQUIRE(parser.validate(asset.get()) == fastgltf::Error::None);
+
+    // The name index gets invalidated by the relocation and rebuilt lazily.
+    REQUIRE(asset->findMeshByName(meshName) == 0);
+
+    // Compacting an already compacted asset is a no-op size-wise but still valid.
+    asset->compact();
+    REQUIRE(parser.validate(asset.get()) == fastgltf::Error::None);
+}
+
+TEST_CASE("Test trusted input mode", "[gltf-loader]") {
+    fastgltf::Parser parser;
+    // This accessor violates the rule that normalized must not be set for float components,
+    // which parsing only checks when the input is not trusted.
+    std::string json = R"({"asset":{"version":"2.0"},)"
+            R"("accessors":[{"componentType":5126,"count":3,"type":"VEC3","normalized":true}]})";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.copyBytes(reinterpret_cast<const std::uint8_t*>(json.data()), json.size()));
+
+    auto strict = parser.loadGLTF(&jsonData, path);
+    REQUIRE(strict.error() == fastgltf::Error::InvalidGltf);
+
+    auto trusted = parser.loadGLTF(&jsonData, path, fastgltf::Options::TrustedInput);
+    REQUIRE(trusted.error() == fastgltf::Error::None);
+    REQUIRE(trusted->accessors.size() == 1);
+    REQUIRE(trusted->accessors.front().normalized);
+
+    // The explicit validation pass still covers the skipped rule.
+    REQUIRE(parser.validate(trusted.get()) == fastgltf::Error::InvalidGltf);
+}
+
+TEST_CASE("Test parallel validation", "[gltf-loader]") {
+    auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(cubePath / "Cube.gltf"));
+
+    fastgltf::Parser parser;
+    auto asset = parser.loadGLTF(&jsonData, cubePath, fastgltf::Options::ParallelParse);
+    REQUIRE(asset.error() == fastgltf::Error::None);
+    // With the last load having used ParallelParse, the categories get validated on threads.
+    REQUIRE(parser.validate(asset.get()) == fastgltf::Error::None);
+}
+
+TEST_CASE("Test mapped external buffers", "[gltf-loader]") {
+    auto cubePath = sampleModels / "2.0" / "Cube" / "glTF";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(cubePath / "Cube.gltf"));
+
+    fastgltf::Parser parser;
+    auto mapped = parser.loadGLTF(&jsonData, cubePath,
+            fastgltf::Options::LoadExternalBuffers | fastgltf::Options::MapExternalBuffers);
+    REQUIRE(mapped.error() == fastgltf::Error::None);
+    REQUIRE(mapped->buffers.size() == 1);
+
+    auto* byteView = std::get_if<fastgltf::sources::ByteView>(&mapped->buffers.front().data);
+    REQUIRE(byteView != nullptr);
+    REQUIRE(byteView->bytes.size() >= mapped->buffers.front().byteLength);
+
+    // The mapped bytes have to match what the copying load path produces.
+    auto copied = parser.loadGLTF(&jsonData, cubePath, fastgltf::Options::LoadExternalBuffers);
+    REQUIRE(copied.error() == fastgltf::Error::None);
+    auto* vector = std::get_if<fastgltf::sources::Vector>(&copied->buffers.front().data);
+    REQUIRE(vector != nullptr);
+    REQUIRE(std::memcmp(byteView->bytes.data(), vector->bytes.data(),
+            copied->buffers.front().byteLength) == 0);
+}
@@ -1,8 +1,20 @@
+#include <chrono>
+#include <cstdio>
 #include <fstream>
 
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_test_macros.hpp>
 
+#if defined(_WIN32)
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#endif
+
 #include "simdjson.h"
 
 #include <fastgltf/parser.hpp>
@@ -81,6 +93,105 @@ std::vector<uint8_t> readFileAsBytes(std::filesystem::path path) {
     return bytes;
 }
 
+// The helpers below complement the Catch2 BENCHMARK cases with what Catch2 doesn't report:
+// throughput relative to the input size, peak memory usage, and an explicit distinction
+// between the first (cache-cold) and the following (cache-warm) runs.
+
+std::size_t getPeakRSSBytes() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters = {};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#else
+    rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+#if defined(__APPLE__)
+    // ru_maxrss is in bytes on macOS, but in kilobytes everywhere else.
+    return static_cast<std::size_t>(usage.ru_maxrss);
+#else
+    return static_cast<std::size_t>(usage.ru_maxrss) * 1024;
+#endif
+#endif
+}
+
+void pinToFirstCore() {
+#if defined(_WIN32)
+    SetThreadAffinityMask(GetCurrentThread(), 1);
+#elif defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(0, &set);
+    sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+template <typename Functor>
+void measureThroughput(const char* phase, std::size_t byteCount, std::size_t iterations, Functor functor) {
+    using clock = std::chrono::steady_clock;
+
+    // The very first iteration runs with cold caches, every further one with warm caches.
+    auto coldBegin = clock::now();
+    functor();
+    auto coldSeconds = std::chrono::duration<double>(clock::now() - coldBegin).count();
+
+    auto warmBegin = clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        functor();
+    }
+    auto warmSeconds = std::chrono::duration<double>(clock::now() - warmBegin).count() / static_cast<double>(iterations);
+
+    auto megabytes = static_cast<double>(byteCount) / (1000.0 * 1000.0);
+    std::printf("%-32s %9.3f MB/s cold, %9.3f MB/s warm (%zu bytes)\n",
+            phase, megabytes / coldSeconds, megabytes / warmSeconds, byteCount);
+}
+
+TEST_CASE("Throughput and memory metrics", "[gltf-benchmark][metrics]") {
+    // Pin the benchmark thread so that core migrations don't distort the cold/warm comparison.
+    pinToFirstCore();
+
+    constexpr std::size_t iterations = 20;
+
+    auto buggyPath = sampleModels / "2.0" / "Buggy" / "glTF";
+    auto bytes = readFileAsBytes(buggyPath / "Buggy.gltf");
+    auto jsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(jsonData->fromByteView(bytes.data(), bytes.size() - fastgltf::getGltfBufferPadding(), bytes.size()));
+
+    fastgltf::Parser parser;
+
+    // Category::None runs simdjson over the document but skips all of fastgltf's own parsing,
+    // which isolates the raw JSON phase from the glTF structure phase.
+    measureThroughput("JSON parse", bytes.size(), iterations, [&] {
+        auto asset = parser.loadGLTF(jsonData.get(), buggyPath, benchmarkOptions, fastgltf::Category::None);
+        REQUIRE(asset.error() == fastgltf::Error::None);
+    });
+
+    measureThroughput("JSON + glTF structure", bytes.size(), iterations, [&] {
+        auto asset = parser.loadGLTF(jsonData.get(), buggyPath, benchmarkOptions);
+        REQUIRE(asset.error() == fastgltf::Error::None);
+    });
+
+    measureThroughput("External buffer load", bytes.size(), iterations, [&] {
+        auto asset = parser.loadGLTF(jsonData.get(), buggyPath, benchmarkOptions | fastgltf::Options::LoadExternalBuffers);
+        REQUIRE(asset.error() == fastgltf::Error::None);
+    });
+
+    // The embedded variant stores its buffers as base64 data URIs, so the buffers category is
+    // dominated by base64 decoding.
+    auto cylinderEngine = sampleModels / "2.0" / "2CylinderEngine" / "glTF-Embedded";
+    auto embeddedBytes = readFileAsBytes(cylinderEngine / "2CylinderEngine.gltf");
+    auto embeddedJsonData = std::make_unique<fastgltf::GltfDataBuffer>();
+    REQUIRE(embeddedJsonData->fromByteView(embeddedBytes.data(), embeddedBytes.size() - fastgltf::getGltfBufferPadding(), embeddedBytes.size()));
+
+    measureThroughput("base64 buffer decode", embeddedBytes.size(), iterations, [&] {
+        auto asset = parser.loadGLTF(embeddedJsonData.get(), cylinderEngine, benchmarkOptions, fastgltf::Category::Buffers);
+        REQUIRE(asset.error() == fastgltf::Error::None);
+    });
+
+    std::printf("%-32s %9.3f MB\n", "Peak RSS", static_cast<double>(getPeakRSSBytes()) / (1000.0 * 1000.0));
+}
+
 TEST_CASE("Benchmark loading of NewSponza", "[gltf-benchmark]") {
     if (!std::filesystem::exists(intelSponza / "NewSponza_Main_glTF_002.gltf")) {
         // NewSponza is not part of gltf-Sample-Models, and therefore not always available.
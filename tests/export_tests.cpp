@@ -0,0 +1,81 @@
+#include <cstring>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <fastgltf/export.hpp>
+#include <fastgltf/parser.hpp>
+#include <fastgltf/types.hpp>
+#include "gltf_path.hpp"
+
+TEST_CASE("Round-trip Box through the binary exporter", "[exporter]") {
+    fastgltf::Parser parser;
+    auto folder = sampleModels / "2.0" / "Box" / "glTF-Binary";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(folder / "Box.glb"));
+
+    // LoadGLBBuffers so that the buffer holds its bytes and can become the new BIN chunk.
+    auto original = parser.loadBinaryGLTF(&jsonData, folder, fastgltf::Options::LoadGLBBuffers);
+    REQUIRE(original.error() == fastgltf::Error::None);
+
+    fastgltf::Exporter exporter;
+    auto exported = exporter.writeBinaryGLTF(original.get());
+    REQUIRE(exported.error() == fastgltf::Error::None);
+    REQUIRE(exported->size() % 4 == 0);
+
+    // Parse the exported bytes again and verify the asset survived the round-trip.
+    std::vector<uint8_t> bytes(exported->size() + fastgltf::getGltfBufferPadding());
+    std::memcpy(bytes.data(), exported->data(), exported->size());
+    fastgltf::GltfDataBuffer exportedData;
+    REQUIRE(exportedData.fromByteView(bytes.data(), exported->size(), bytes.size()));
+
+    auto roundTripped = parser.loadBinaryGLTF(&exportedData, folder, fastgltf::Options::None);
+    REQUIRE(roundTripped.error() == fastgltf::Error::None);
+    REQUIRE(parser.validate(roundTripped.get()) == fastgltf::Error::None);
+
+    REQUIRE(roundTripped->buffers.size() == original->buffers.size());
+    REQUIRE(roundTripped->bufferViews.size() == original->bufferViews.size());
+    REQUIRE(roundTripped->accessors.size() == original->accessors.size());
+    REQUIRE(roundTripped->meshes.size() == original->meshes.size());
+    REQUIRE(roundTripped->nodes.size() == original->nodes.size());
+    REQUIRE(roundTripped->scenes.size() == original->scenes.size());
+    REQUIRE(roundTripped->buffers.front().byteLength == original->buffers.front().byteLength);
+
+    for (std::size_t i = 0; i < original->accessors.size(); ++i) {
+        REQUIRE(roundTripped->accessors[i].count == original->accessors[i].count);
+        REQUIRE(roundTripped->accessors[i].type == original->accessors[i].type);
+        REQUIRE(roundTripped->accessors[i].componentType == original->accessors[i].componentType);
+    }
+
+    for (std::size_t i = 0; i < original->nodes.size(); ++i) {
+        REQUIRE(roundTripped->nodes[i].name == original->nodes[i].name);
+        REQUIRE(roundTripped->nodes[i].meshIndex == original->nodes[i].meshIndex);
+        REQUIRE(roundTripped->nodes[i].children.size() == original->nodes[i].children.size());
+    }
+}
+
+TEST_CASE("Export glTF JSON", "[exporter]") {
+    fastgltf::Parser parser;
+    auto folder = sampleModels / "2.0" / "Box" / "glTF";
+    fastgltf::GltfDataBuffer jsonData;
+    REQUIRE(jsonData.loadFromFile(folder / "Box.gltf"));
+
+    auto original = parser.loadGLTF(&jsonData, folder);
+    REQUIRE(original.error() == fastgltf::Error::None);
+
+    fastgltf::Exporter exporter;
+
+    SECTION("Buffers with URI sources serialize") {
+        auto json = exporter.writeGltfJson(original.get());
+        REQUIRE(json.error() == fastgltf::Error::None);
+        REQUIRE(!json->empty());
+        REQUIRE(json->find("\"uri\":\"Box0.bin\"") != std::string::npos);
+    }
+
+    SECTION("In-memory buffers cannot be referenced from standalone JSON") {
+        fastgltf::sources::Vector vector;
+        vector.bytes.resize(original->buffers.front().byteLength);
+        original->buffers.front().data = std::move(vector);
+        auto json = exporter.writeGltfJson(original.get());
+        REQUIRE(json.error() == fastgltf::Error::InvalidGltf);
+    }
+}
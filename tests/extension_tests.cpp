@@ -197,3 +197,15 @@ TEST_CASE("Test KHR_materials_clearcoat", "[gltf-loader]") {
     REQUIRE(materials[7].clearcoat->clearcoatRoughnessTexture->textureIndex == 2);
     REQUIRE(materials[7].clearcoat->clearcoatRoughnessTexture->texCoordIndex == 0);
 }
+
+TEST_CASE("Compile-time extension configuration", "[gltf-loader]") {
+    // By default every extension is compiled in, so the constexpr helpers behave exactly like
+    // the runtime hasBit checks they replace in the parsing hot path.
+    static_assert(fastgltf::isExtensionEnabled(fastgltf::Extensions::KHR_texture_transform));
+    static_assert(fastgltf::isExtensionEnabled(fastgltf::Extensions::KHR_materials_volume));
+    static_assert(!fastgltf::hasCompiledBit<fastgltf::Extensions::KHR_mesh_quantization>(fastgltf::Extensions::None));
+    static_assert(fastgltf::hasCompiledBit<fastgltf::Extensions::KHR_mesh_quantization>(
+        fastgltf::Extensions::KHR_mesh_quantization | fastgltf::Extensions::KHR_texture_transform));
+
+    REQUIRE(fastgltf::hasBit(fastgltf::compiledExtensions, fastgltf::Extensions::KHR_lights_punctual));
+}
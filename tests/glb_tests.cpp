@@ -41,6 +41,26 @@ TEST_CASE("Load basic GLB file", "[gltf-loader]") {
         REQUIRE(static_cast<uint64_t>(bufferVector->bytes.size() - buffer.byteLength) < 3);
     }
 
+    SECTION("Load memory-mapped Box.glb") {
+        fastgltf::MappedGltfDataBuffer mappedData;
+        REQUIRE(mappedData.mapFromFile(folder / "Box.glb"));
+
+        auto asset = parser.loadBinaryGLTF(&mappedData, folder, fastgltf::Options::None, fastgltf::Category::Buffers);
+        REQUIRE(asset.error() == fastgltf::Error::None);
+		REQUIRE(parser.validate(asset.get()) == fastgltf::Error::None);
+
+        REQUIRE(asset->buffers.size() == 1);
+
+        // Without LoadGLBBuffers the BIN chunk has to point straight into the mapping.
+        auto& buffer = asset->buffers.front();
+        auto* bufferView = std::get_if<fastgltf::sources::ByteView>(&buffer.data);
+        REQUIRE(bufferView != nullptr);
+        if (mappedData.isMapped()) {
+            auto mappedSpan = fastgltf::span<std::byte>(mappedData);
+            REQUIRE(bufferView->bytes.data() - mappedSpan.data() == 1016);
+        }
+    }
+
     SECTION("Load GLB by bytes") {
         std::ifstream file(folder / "Box.glb", std::ios::binary | std::ios::ate);
         auto length = static_cast<size_t>(file.tellg());
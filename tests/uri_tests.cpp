@@ -67,6 +67,24 @@ TEST_CASE("Test percent decoding", "[uri-tests]") {
     std::pmr::string test = "%22 %25";
     fastgltf::URI::decodePercents(test);
     REQUIRE(test == "\" %");
+
+    SECTION("Strings without escapes are left untouched") {
+        std::pmr::string plain = "path/somewhere.xyz";
+        fastgltf::URI::decodePercents(plain);
+        REQUIRE(plain == "path/somewhere.xyz");
+    }
+
+    SECTION("Many escapes") {
+        std::pmr::string escaped = "a%20b%20c%20d%20e";
+        fastgltf::URI::decodePercents(escaped);
+        REQUIRE(escaped == "a b c d e");
+    }
+
+    SECTION("Truncated escape at the end of the string") {
+        std::pmr::string truncated = "file%2";
+        fastgltf::URI::decodePercents(truncated);
+        REQUIRE(truncated == "file%2");
+    }
 }
 
 TEST_CASE("Test data URI parsing", "[uri-tests]") {
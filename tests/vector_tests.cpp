@@ -113,3 +113,30 @@ TEST_CASE("Test vectors with polymorphic allocators", "[vector-tests]") {
 		REQUIRE(i == 5);
 	}
 }
+
+TEST_CASE("Test growth policy", "[vector-tests]") {
+	fastgltf::SmallVector<std::uint32_t, 4> vec;
+
+	// Exact powers of two are honoured as-is, everything else rounds up to the next power.
+	vec.reserve(16);
+	REQUIRE(vec.capacity() == 16);
+	vec.reserve(17);
+	REQUIRE(vec.capacity() == 32);
+}
+
+TEST_CASE("Test trivial relocation", "[vector-tests]") {
+	fastgltf::SmallVector<std::size_t, 2> vec;
+	for (std::size_t i = 0; i < 100; ++i) {
+		vec.emplace_back(i);
+	}
+	REQUIRE(vec.size() == 100);
+	for (std::size_t i = 0; i < 100; ++i) {
+		REQUIRE(vec[i] == i);
+	}
+
+	vec.shrink_to_fit();
+	REQUIRE(vec.capacity() == 100);
+	for (std::size_t i = 0; i < 100; ++i) {
+		REQUIRE(vec[i] == i);
+	}
+}